@@ -0,0 +1,824 @@
+#include "Menus.h"
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------
+ * -------------------------------- Tournament Scheduling and Player Progression ----------------------------------
+ * ----------------------------------------------------------------------------------------------------------------
+ */
+/**
+ * Function to track a player's performance
+ */
+void trackPlayerPerformance() {
+    string playerId;
+    cout << "Enter player ID: ";
+    cin >> playerId;
+
+    map<string, string> players = readPlayersByID("Players.txt");
+
+    if (players.find(playerId) == players.end()) {
+        cout << "Player not found" << endl;
+        return;
+    }
+
+    vector<matchHistory> matches;
+    readMatches("MatchHistory.txt", matches);
+
+    cout << "Player ID: " << playerId << endl;
+    cout << "Player Name: " << players[playerId] << endl;
+    cout << "Performance: " << endl;
+
+    int matchesPlayed = 0, wins = 0, losses = 0;
+
+    for (const matchHistory& match : matches) {
+        if (match.p1Id == playerId || match.p2Id == playerId) {
+            matchesPlayed++;
+            cout << "MatchID: " << match.matchId << endl;
+            cout << "Scores: " << match.setScores << endl;
+
+            // Determine win/loss from SetScores
+            int p1Score = match.setScores[0] - '0'; // First digit
+            int p2Score = match.setScores[2] - '0'; // Third digit
+
+            if ((match.p1Id == playerId && p1Score > p2Score) ||
+                (match.p2Id == playerId && p2Score > p1Score)) {
+                wins++;
+            } else {
+                losses++;
+            }
+        }
+    }
+
+    cout << "Matches Played: " << matchesPlayed << endl;
+    cout << "Wins: " << wins << endl;
+    cout << "Losses: " << losses << endl;
+}
+
+void tournamentScheduleAndPlayer() {
+    TournamentScheduler scheduler;
+    int choice;
+    string input;
+    string p1ID;
+    bool running = true;
+    while (running) {
+        cout << "\n--- Tennis Tournament Management System ---" << endl;
+        cout << "1. Schedule a Match" << endl;
+        cout << "2. Display Scheduled Matches" << endl;
+        cout << "3. Display Available Players" << endl;
+        cout << "4. Advance Player Stage" << endl;
+        cout << "5. Track Player Performance" << endl;
+        cout << "6. Auto-Schedule All Stages" << endl;
+        cout << "7. Optimize Schedule" << endl;
+        cout << "8. Generate Round Robin Groups" << endl;
+        cout << "9. View Group Standings" << endl;
+        cout << "10. Generate Knockout Bracket" << endl;
+        cout << "11. View Knockout Bracket" << endl;
+        cout << "12. Advance All Qualifiers of a Stage" << endl;
+        cout << "13. Exit" << endl;
+        cout << "Enter your choice: ";
+        cin >> choice;
+        
+        if (cin.fail()) {
+            cin.clear();
+            cin.ignore(numeric_limits<streamsize>::max(), '\n'); // Discard input
+            cout << "Invalid input. Please try again." << endl;
+            continue;
+        }
+
+        switch(choice) {
+            case 1: {
+                cout << "Enter Player 1 ID: ";
+                cin >> p1ID;
+                scheduler.scheduleMatch(p1ID);
+                break;
+            }
+            case 2:
+                scheduler.displayScheduledMatches();
+                break;
+            case 3:
+                scheduler.displayAllAvailablePlayers();
+                break;
+            case 4: {
+                cout << "Enter Player ID to advance: ";
+                cin >> p1ID;
+                scheduler.advancePlayerStage(p1ID);
+                break;
+            }
+            case 5:
+                cout << "Track Player Performance" << endl;
+                trackPlayerPerformance();
+                break;
+            case 6:
+                scheduler.scheduleAllStages();
+                break;
+            case 7: {
+                int budgetMs;
+                string fromDate;
+                cout << "Enter time budget in milliseconds: ";
+                cin >> budgetMs;
+                cout << "Re-plan from date (DD-MM-YYYY, or 'all'): ";
+                cin >> fromDate;
+                MatchTime replanFrom = tournamentStart();
+                if (fromDate != "all") {
+                    replanFrom = parseMatchTime(fromDate);
+                }
+                if (cin.fail() || budgetMs < 0 || replanFrom < 0) {
+                    cin.clear();
+                    cin.ignore(numeric_limits<streamsize>::max(), '\n');
+                    cout << "Invalid input." << endl;
+                    break;
+                }
+                scheduler.optimizeSchedule(budgetMs, replanFrom);
+                break;
+            }
+            case 8: {
+                int groupSize;
+                cout << "Enter players per group: ";
+                cin >> groupSize;
+                if (cin.fail() || groupSize < 2) {
+                    cin.clear();
+                    cin.ignore(numeric_limits<streamsize>::max(), '\n');
+                    cout << "Invalid group size." << endl;
+                    break;
+                }
+                scheduler.scheduleRoundRobin(groupSize);
+                break;
+            }
+            case 9:
+                scheduler.displayStandings();
+                break;
+            case 10:
+                scheduler.scheduleKnockout();
+                break;
+            case 11: {
+                KnockoutBracket bracket;
+                bracket.load();
+                bracket.display();
+                break;
+            }
+            case 12: {
+                string stageID;
+                cout << "Enter Stage ID to close (S001/S002): ";
+                cin >> stageID;
+                scheduler.advanceStage(stageID);
+                break;
+            }
+            case 13:
+                cout << "Exiting..." << endl;
+                running = false;
+                break;
+            default:
+                cout << "Invalid choice. Please try again." << endl;
+                break;
+        }
+    }
+}
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------
+ * ----------------------------------- Ticket Sales and Spectator Management --------------------------------------
+ * ----------------------------------------------------------------------------------------------------------------
+ */
+/**
+ * Function to add a spectator to the priority queue without assigning ticketID
+ * @param context The ticketing session
+ */
+void addSpectatorToQueue(TicketingContext& context) {
+    context.ticketableMatches.refresh(); // Reparse Matches.txt only if it changed
+    int matchCount = context.ticketableMatches.size(); // Variable to store the number of matches
+
+    // Check if there is no match available
+    if (matchCount == 0) {
+        cout << "No matches available for ticket purchase at this time.\n";
+        return;
+    }
+
+    // Variables to store spectator details
+    string name, ticketType;
+    int seatsQuantity;
+
+    // Get the spectator name
+    cout << "Enter spectator name: ";
+    cin.ignore(); // Clearing input buffer (like newline)
+    getline(cin, name); // Read the spectator's name
+
+    // Get the ticket type
+    cout << "Enter ticket type (VIP, Early-bird, General): ";
+    getline(cin, ticketType);
+    // Validate the ticket type
+    while (ticketType != "VIP" && ticketType != "Early-bird" && ticketType != "General") {
+        cout << "\nInvalid ticket type! Please enter again (VIP, Early-bird, General): ";
+        getline(cin, ticketType);
+    }
+
+    // Display available matches for selection
+    cout << "===================================Select match===================================\n";
+    // Loop through the matches
+    for (int index = 0; index < matchCount; index++) {
+        const Match& match = context.ticketableMatches.at(index);
+        cout << (index + 1) << ". MatchID: " << match.matchID 
+            << ", StageID: " << match.stageID
+            << ", RoundID: " << match.roundID << ", "
+            << match.p1ID << " vs " << match.p2ID
+            << ", Scheduled: " << formatMatchTime(match.dateTime)
+            << ", Status: " << match.matchStatus
+            << ", Court: " << match.courtID << "\n";
+    }
+
+    // The selected match, by list number or by MatchID
+    const Match* selected = nullptr;
+    if (matchCount == 1) {
+        selected = &context.ticketableMatches.at(0);
+    } else {
+        while (selected == nullptr) {
+            cout << "Enter your choice (1-" << matchCount << ") or MatchID: ";
+            string choice;
+            cin >> choice;
+            selected = context.ticketableMatches.find(choice);
+            int matchChoice;
+            if (selected == nullptr && parseInt(choice, matchChoice) && matchChoice >= 1 && matchChoice <= matchCount) {
+                selected = &context.ticketableMatches.at(matchChoice - 1);
+            }
+            if (selected == nullptr) {
+                cout << "Invalid choice.\n";
+            }
+        }
+    }
+
+    cout << "Enter number of tickets to purchase: ";
+    string quantity;
+    cin >> quantity;
+    // Validate the number of tickets
+    while (!parseInt(quantity, seatsQuantity) || seatsQuantity <= 0) {
+        cout << "Invalid quantity! Enter a positive number: ";
+        cin >> quantity;
+    }
+
+    // Hold the seats and queue the spectator
+    if (enqueueSpectator(context, name, ticketType, *selected, seatsQuantity) == nullptr) {
+        cout << "\nNot enough seats left on court " << selected -> courtID << " for " << seatsQuantity << " tickets.\n";
+    } else {
+        cout << "\nSpectator " << name << " (Type: " << ticketType << ") added to the queue. Seats are held for "
+            << HOLD_TTL_SECONDS / 60 << " minutes.\n";
+    }
+}
+
+/**
+ * Function to display and handle the Ticket Sales Menu
+ * @param context The ticketing session
+ */
+void ticketSalesMenu(TicketingContext& context) {
+    int choice;
+    do {
+        cout << "\n==============================Ticket Sales Menu==============================\n";
+        cout << "1. Add Spectator to Queue\n";
+        cout << "2. Process Ticket Queue\n";
+        cout << "3. View Sales Record\n";
+        cout << "4. View Sales Analytics\n";
+        cout << "5. Set Ticketing Date Range\n";
+        cout << "6. Back to Main Menu\n";
+        cout << "Enter choice: ";
+        cin >> choice;
+
+        // Handle user choice
+        switch (choice) {
+            case 1:
+                addSpectatorToQueue(context);
+                break;
+            case 2:
+                processTicketQueue(context);
+                break;
+            case 3:
+                viewSalesRecord();
+                break;
+            case 4:
+                context.salesAnalytics.display();
+                break;
+            case 5: {
+                string fromDate, toDate;
+                cout << "Enter first date (DD-MM-YYYY): ";
+                cin >> fromDate;
+                cout << "Enter last date (DD-MM-YYYY): ";
+                cin >> toDate;
+                if (setTicketingWindow(context, fromDate, toDate)) {
+                    cout << "Tickets are now sold for matches from " << fromDate << " to " << toDate << ".\n";
+                } else {
+                    cout << "Invalid date range.\n";
+                }
+                break;
+            }
+            case 6:
+                cout << "Returning to the Main Menu...\n";
+                break;
+            default:
+                cout << "Invalid choice! Please try again.\n";
+        }
+    } while (choice != 6); // Continue until the user choose to exit
+}
+
+/**
+ * Function to display and handle the Spectator Management Menu
+ * @param context The ticketing session
+ */
+void spectatorManagementMenu(TicketingContext& context) {
+    int choice;
+    do {
+        cout << "\n==============================Spectator Management Menu==============================\n";
+        cout << "1. Add Entry Request\n";
+        cout << "2. Add Exit Request\n";
+        cout << "3. View All Gate Requests Process\n";
+        cout << "4. Back to Main Menu\n";
+        cout << "Enter choice: ";
+        cin >> choice;
+
+        // Handle user choice
+        switch (choice) {
+            case 1: {
+                string ticketID;
+                cout << "\nPlease insert your ticketID to enter: ";
+                cin.ignore();
+                getline(cin, ticketID);
+                enqueueGateRequest(context, ticketID, true);
+                cout << "\nEntry request for ticketID " << ticketID << " added to the queue.\n";
+                break;
+            }
+            case 2: {
+                string ticketID;
+                cout << "\nPlease insert your ticketID to exit: ";
+                cin.ignore();
+                getline(cin, ticketID);
+                enqueueGateRequest(context, ticketID, false);
+                cout << "\nExit request for ticketID " << ticketID << " added to the queue.\n";
+                break;
+            }
+            case 3:
+                if (isGateRequestQueueEmpty(context)) {
+                    cout << "\nNo gate requests to process.\n";
+                } else {
+                    cout << "\nProcessing all gate requests...\n";
+                    processGateRequests(context);
+                }
+                break;
+            case 4:
+                cout << "\nReturning to Main Menu...\n";
+                break;
+            default:
+                cout << "Invalid choice! Try again.\n";
+        }
+    } while (choice != 4); // Continue until the user choose to exit
+}
+
+/**
+ * Ticket Sales and Spectator Management
+ */
+void ticketSales() {
+    AsyncFileWriter::instance().rewrite("Sales.txt", "");
+    // A fresh session; its destructor frees the lists and queues on exit
+    TicketingContext context;
+    loadSeatMaps(context);
+    // Sales, spectators and court capacities of earlier sessions come back from the event log
+    restoreTicketing(context, EventLog::instance().state());
+
+    // Handle user choice
+    int choice;
+    do {
+        cout << "\n========================Ticket Sales and Spectator Management Main Menu========================\n";
+        cout << "1. Ticket Sales Menu Page\n";
+        cout << "2. Spectator Management Menu Page\n";
+        cout << "3. Exit\n";
+        cout << "Enter choice: ";
+        cin >> choice;
+
+        switch (choice) {
+            case 1:
+                ticketSalesMenu(context);
+                break;
+            case 2:
+                spectatorManagementMenu(context);
+                break;
+            case 3:
+                cout << "\nExiting Ticket Sales and Spectator Management Main Menu...\n";
+                break;
+            default:
+                cout << "\nInvalid choice! Please try again.\n";
+        }
+    } while (choice != 3); // Continue until the user choose to exit
+
+}
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------
+ * ----------------------------------------- Handling Player Withdrawal -------------------------------------------
+ * ----------------------------------------------------------------------------------------------------------------
+ */
+/**
+ * Print available players
+ * @param players the map of players
+ */
+void printAvailablePlayers(const map<string, string>& players) {
+    cout << "Available Players:\n";
+    cout << "========================================\n";
+    cout << left << setw(15) << "Player ID" << "Name\n";
+    cout << "========================================\n";
+    for (const auto& [name, id] : players) {
+        cout << left << setw(15) << id << name << endl;
+    }
+    cout << "========================================\n";
+}
+
+/**
+ * Handle user input for player withdrawals
+ * @param withdrawals the player withdrawals object
+ */
+void withdrawPlayer(PlayerWithdrawals &withdrawals) {
+    // Read players from file
+    map<string, string> players = readPlayersFromFile("Players.txt");
+    printAvailablePlayers(players);
+
+    string name;
+    // Enter player name to withdraw
+    cout << "Enter player name to withdraw: ";
+    cin >> ws; // Remove leading whitespace
+    getline(cin, name);
+    cout << "----------------------------------------" << endl;
+
+    // Check if player exists
+    if (players.find(name) == players.end()) {
+        cout << "Player not found" << endl;
+        return;
+    }
+
+    string playerId = players[name], reason;
+    // Enter reason for withdrawal
+    cout << "Enter reason for withdrawal: ";
+    getline(cin, reason);
+    cout << "----------------------------------------" << endl;
+
+    withdrawPlayers(withdrawals, vector<WithdrawalRequest>{WithdrawalRequest{playerId, name, reason}});
+}
+
+/**
+ * Handle user input for withdrawing a group of players with one reason
+ * @param withdrawals the player withdrawals object
+ */
+void withdrawPlayersInBulk(PlayerWithdrawals &withdrawals) {
+    int mode;
+    cout << "1. Withdraw all players of a nationality" << endl;
+    cout << "2. Withdraw a list of players" << endl;
+    cout << "Enter your choice: ";
+    cin >> mode;
+    if (cin.fail() || (mode != 1 && mode != 2)) {
+        cin.clear();
+        cin.ignore(numeric_limits<streamsize>::max(), '\n');
+        cout << "Invalid choice." << endl;
+        return;
+    }
+
+    string selection;
+    cout << (mode == 1 ? "Enter nationality: " : "Enter player names separated by commas: ");
+    cin >> ws;
+    getline(cin, selection);
+    set<string> names;
+    stringstream selectionSS(selection);
+    string item;
+    while (getline(selectionSS, item, ',')) {
+        item.erase(0, item.find_first_not_of(' '));
+        item.erase(item.find_last_not_of(' ') + 1);
+        if (!item.empty()) names.insert(item);
+    }
+
+    string reason;
+    cout << "Enter reason for withdrawal: ";
+    getline(cin, reason);
+    cout << "----------------------------------------" << endl;
+
+    // One pass over Players.txt selects every matching player
+    vector<WithdrawalRequest> requests;
+    syncFile("Players.txt");
+    ifstream file("Players.txt");
+    string line;
+    while (getline(file, line)) {
+        stringstream ss(line);
+        string playerId, name, nationality;
+        getline(ss, playerId, ',');
+        getline(ss, name, ',');
+        getline(ss, nationality, ',');
+        bool selected = mode == 1 ? names.count(nationality) > 0 : names.erase(name) > 0;
+        if (selected) requests.push_back(WithdrawalRequest{playerId, name, reason});
+    }
+    if (mode == 2) {
+        for (const string& name : names) cout << "Player not found: " << name << endl;
+    }
+
+    if (requests.empty()) {
+        cout << "No players selected." << endl;
+        return;
+    }
+    withdrawPlayers(withdrawals, requests);
+}
+
+/**
+ * Handle user input for browsing the withdrawal history page by page
+ * @param withdrawals the player withdrawals object
+ */
+void viewWithdrawalHistory(const PlayerWithdrawals &withdrawals) {
+    const int pageSize = 10;
+    int filter;
+    cout << "1. All withdrawals" << endl;
+    cout << "2. By player ID" << endl;
+    cout << "3. By date range" << endl;
+    cout << "4. By reason keyword" << endl;
+    cout << "Enter your choice: ";
+    cin >> filter;
+    if (cin.fail() || filter < 1 || filter > 4) {
+        cin.clear();
+        cin.ignore(numeric_limits<streamsize>::max(), '\n');
+        cout << "Invalid choice." << endl;
+        return;
+    }
+
+    string first, second;
+    if (filter == 2) {
+        cout << "Enter player ID: ";
+        cin >> first;
+    } else if (filter == 3) {
+        cout << "Enter start date (YYYY-MM-DD): ";
+        cin >> first;
+        cout << "Enter end date (YYYY-MM-DD): ";
+        cin >> second;
+    } else if (filter == 4) {
+        cout << "Enter reason keywords: ";
+        cin.ignore(numeric_limits<streamsize>::max(), '\n');
+        getline(cin, first);
+    }
+
+    int page = 1;
+    while (true) {
+        WithdrawalPage result;
+        switch (filter) {
+            case 1: result = withdrawals.recent(page, pageSize); break;
+            case 2: result = withdrawals.findByPlayer(first, page, pageSize); break;
+            case 3: result = withdrawals.findByTimeWindow(first, second, page, pageSize); break;
+            default: result = withdrawals.findByReason(first, page, pageSize); break;
+        }
+        PlayerWithdrawals::displayPage(result, page, pageSize);
+        if (page * pageSize >= result.total) break;
+
+        char more;
+        cout << "Show next page? (y/n): ";
+        cin >> more;
+        if (cin.fail() || (more != 'y' && more != 'Y')) break;
+        page++;
+    }
+}
+
+/**
+ * Create a new player
+ */
+void createNewPlayer() {
+    struct newPlayer {
+        string name;
+        string nationality;
+        string ranking;
+        string gender;
+        string stage;
+    };
+
+    newPlayer Player;
+    cin.ignore();
+    cout << "Add Player" << endl;
+    cout << "Enter player name: ";
+    cin >> Player.name;
+    cout << "Enter player nationality: ";
+    cin >> Player.nationality;
+    cout << "Enter player ranking: ";
+    cin >> Player.ranking;
+    cout << "Enter player gender: ";
+    cin >> Player.gender;
+
+    string playerId = generateId("Players.txt", "APUTCP", 3);
+
+    ostringstream record;
+    record << playerId << ","
+        << Player.name << ","
+        << Player.nationality << ","
+        << Player.ranking << ","
+        << Player.gender << ","
+        << "S001" << "\n";
+    AsyncFileWriter::instance().append("Players.txt", record.str());
+    cout << "Player added successfully." << endl;
+}
+
+void HandlePlayer() {
+    PlayerWithdrawals playerWithdrawals;
+    bool running = true;
+    while (running) {
+        int choice;
+        cout << "==================== Player Menu ====================" << endl;
+        cout << "1. Create a new player" << endl;
+        cout << "2. Withdraw a player" << endl;
+        cout << "3. Withdraw players in bulk" << endl;
+        cout << "4. View withdrawal history" << endl;
+        cout << "5. Exit to main menu" << endl;
+        cout << "===================================================" << endl;
+        cout << "Enter your choice: ";
+        cin >> choice;
+        // Input validation
+        if (cin.fail()) {
+            cin.clear();
+            cin.ignore(numeric_limits<streamsize>::max(), '\n'); // Discard input
+            cout << "Invalid input. Please try again." << endl;
+            continue;
+        }
+        switch (choice) {
+            case 1:
+                createNewPlayer();
+                break;
+            case 2:
+                withdrawPlayer(playerWithdrawals);
+                break;
+            case 3:
+                withdrawPlayersInBulk(playerWithdrawals);
+                break;
+            case 4:
+                viewWithdrawalHistory(playerWithdrawals);
+                break;
+            case 5:
+                cout << "Exiting Player Menu..." << endl;
+                running = false;
+                break;
+            default:
+                cout << "Invalid choice. Please try again." << endl;
+        }
+    }
+}
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------
+ * ------------------------------------------ Match History Tracking ----------------------------------------------
+ * ----------------------------------------------------------------------------------------------------------------
+ */
+void matchHistoryTrack() {
+    MatchHistoryManager manager;
+    int choice;
+    bool running = true;
+    while (running) {
+        cout << "\n===== Match History Management =====\n";
+        cout << "1. Record a New Match\n";
+        cout << "2. Update Match Status\n";
+        cout << "3. Display All Match History\n";
+        cout << "4. Search Matches by Player\n";
+        cout << "5. Search Matches by Stage\n";
+        cout << "6. Generate Statistics Report\n";
+        cout << "7. View Rating Leaderboard\n";
+        cout << "8. View Win Rate Leaderboard\n";
+        cout << "9. Exit\n";
+        cout << "Enter your choice: ";
+        cin >> choice;
+        // Input validation
+        if (cin.fail()) {
+            cin.clear();
+            cin.ignore(numeric_limits<streamsize>::max(), '\n'); // Discard input
+            cout << "Invalid input. Please try again." << endl;
+            continue;
+        }
+        switch (choice) {
+            case 1:
+                manager.recordMatch();
+                break;
+            case 2:
+                manager.updateMatchStatus();
+                break;
+            case 3:
+                manager.displayHistory();
+                break;
+            case 4:
+                manager.searchMatchesByPlayer();
+                break;
+            case 5:
+                manager.searchMatchesByStage();
+                break;
+            case 6:
+                manager.generateStatsReport();
+                break;
+            case 7:
+                manager.viewRatings();
+                break;
+            case 8:
+                manager.viewWinRates();
+                break;
+            case 9:
+                cout << "Exiting program...\n";
+                running = false;
+                break;
+            default:
+                cout << "Invalid choice! Please enter a valid option.\n";
+        }
+    }
+}
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------
+ * ------------------------------------------------ Event Log Audit -----------------------------------------------
+ * ----------------------------------------------------------------------------------------------------------------
+ */
+/**
+ * Ask for an audit time
+ * @param timestamp Output: the time as seconds since 01-01-1970
+ * @return True if a valid time was entered, else False
+ */
+static bool readAuditTime(int64_t& timestamp) {
+    cout << "Enter the audit time (YYYY-MM-DD HH:MM:SS): ";
+    cin.ignore(numeric_limits<streamsize>::max(), '\n');
+    string line;
+    getline(cin, line);
+    struct tm when = {};
+    istringstream iss(line);
+    iss >> get_time(&when, "%Y-%m-%d %H:%M:%S");
+    if (iss.fail()) {
+        cout << "Invalid time. Use the format YYYY-MM-DD HH:MM:SS." << endl;
+        return false;
+    }
+    when.tm_isdst = -1;
+    timestamp = mktime(&when);
+    return true;
+}
+
+/**
+ * Audit the event log: the current state, the state as of an earlier time and snapshots
+ */
+void eventLogAudit() {
+    EventLog& eventLog = EventLog::instance();
+    if (!eventLog.isEnabled()) {
+        cout << "The event log is disabled (TOURNAMENT_EVENT_LOG=off)." << endl;
+        return;
+    }
+    int choice;
+    bool running = true;
+    while (running) {
+        cout << "\n===== Event Log Audit (" << eventLog.getFilename() << ") =====\n";
+        cout << "1. Current State Summary\n";
+        cout << "2. State Summary as of a Time\n";
+        cout << "3. Scheduled Matches as of a Time\n";
+        cout << "4. Match History as of a Time\n";
+        cout << "5. Write a Snapshot Now\n";
+        cout << "6. Exit\n";
+        cout << "Enter your choice: ";
+        cin >> choice;
+        // Input validation
+        if (cin.fail()) {
+            cin.clear();
+            cin.ignore(numeric_limits<streamsize>::max(), '\n'); // Discard input
+            cout << "Invalid input. Please try again." << endl;
+            continue;
+        }
+        int64_t timestamp;
+        switch (choice) {
+            case 1:
+                eventLog.state().display();
+                break;
+            case 2:
+                if (readAuditTime(timestamp)) eventLog.stateAsOf(timestamp).display();
+                break;
+            case 3:
+                if (readAuditTime(timestamp)) {
+                    TournamentScheduler scheduler;
+                    scheduler.restoreFromState(eventLog.stateAsOf(timestamp));
+                    scheduler.displayScheduledMatches();
+                }
+                break;
+            case 4:
+                if (readAuditTime(timestamp)) {
+                    MatchHistoryManager manager;
+                    manager.restoreFromState(eventLog.stateAsOf(timestamp));
+                    manager.displayHistory();
+                }
+                break;
+            case 5:
+                if (eventLog.writeSnapshot()) {
+                    cout << "Snapshot written." << endl;
+                } else {
+                    cout << "The snapshot could not be written." << endl;
+                }
+                break;
+            case 6:
+                running = false;
+                break;
+            default:
+                cout << "Invalid choice! Please enter a valid option.\n";
+        }
+    }
+}
+
+/**
+ * Display User Menu
+ */
+void displayMenu() {
+    cout << "==================== User Menu ====================" << endl;
+    cout << "1. Tournament Scheduling and Player Progression" << endl;
+    cout << "2. Ticket Sales and Spectator Management" << endl;
+    cout << "3. Handling Player Withdrawal" << endl;
+    cout << "4. Match History Tracking" << endl;
+    cout << "5. Event Log Audit" << endl;
+    cout << "===================================================" << endl;
+    cout << "Enter your choice: ";
+}
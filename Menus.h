@@ -0,0 +1,36 @@
+#ifndef MENUS_H
+#define MENUS_H
+
+#include "core/Scheduling.h"
+#include "core/Ticketing.h"
+#include "core/Withdrawals.h"
+#include "core/MatchHistory.h"
+
+// Tournament Scheduling and Player Progression
+void trackPlayerPerformance();
+void tournamentScheduleAndPlayer();
+
+// Ticket Sales and Spectator Management
+void addSpectatorToQueue(TicketingContext& context);
+void ticketSalesMenu(TicketingContext& context);
+void spectatorManagementMenu(TicketingContext& context);
+void ticketSales();
+
+// Handling Player Withdrawal
+void printAvailablePlayers(const map<string, string>& players);
+void withdrawPlayer(PlayerWithdrawals &withdrawals);
+void withdrawPlayersInBulk(PlayerWithdrawals &withdrawals);
+void viewWithdrawalHistory(const PlayerWithdrawals &withdrawals);
+void createNewPlayer();
+void HandlePlayer();
+
+// Match History Tracking
+void matchHistoryTrack();
+
+// Event Log Audit
+void eventLogAudit();
+
+// User Menu of the combined front-end
+void displayMenu();
+
+#endif
@@ -0,0 +1,105 @@
+#include "BenchData.h"
+#include "core/Scheduling.h"
+
+/**
+ * Format a record ID with a prefix and a zero-padded number
+ * @param prefix the ID prefix e.g. M
+ * @param number the record number
+ * @param width the number of digits
+ */
+static string makeId(const string& prefix, int number, int width) {
+    stringstream ss;
+    ss << prefix << setfill('0') << setw(width) << number;
+    return ss.str();
+}
+
+string benchPlayerId(int number) {
+    return makeId("APUTCP", number, 5);
+}
+
+/**
+ * Write a deterministic data set in the current directory
+ * @param scale the number of records of each file
+ * @param seed the random seed
+ */
+void generateBenchData(const BenchScale& scale, unsigned seed) {
+    mt19937 rng(seed);
+    const string nationalities[] = {"MY", "SG", "ID", "TH", "AU", "JP", "GB", "US"};
+    const string reasons[] = {"Injury", "Illness", "Family emergency", "Travel delay, missed flight", "Personal reasons"};
+    const string stages[] = {"S001", "S002", "S003"};
+    const string stageCourts[] = {"C003", "C002", "C001"};
+
+    // Players: half in the qualifiers, the rest split over round robin and knockout
+    vector<int> rankings(scale.players);
+    for (int i = 0; i < scale.players; i++) rankings[i] = i + 1;
+    shuffle(rankings.begin(), rankings.end(), rng);
+
+    vector<vector<int>> playersByStage(3);
+    string buffer;
+    for (int i = 1; i <= scale.players; i++) {
+        int stage = i % 10 < 5 ? 0 : (i % 10 < 8 ? 1 : 2);
+        playersByStage[stage].push_back(i);
+        const string& nationality = nationalities[rng() % 8];
+        buffer += benchPlayerId(i) + ",Player " + to_string(i) + "," + nationality + ","
+                + to_string(rankings[i - 1]) + "," + (i % 2 ? "M" : "F") + "," + stages[stage] + "\n";
+    }
+    ofstream("Players.txt") << buffer;
+
+    ofstream("Court.txt") << "C001,Center,1500,2\nC002,Championship,1000,1\nC003,Progression,750,1\n";
+
+    // Matches: one per hour and court from the tournament's first day, most of them still waiting
+    buffer.clear();
+    MatchTime firstDay = tournamentStart() + DAY_FIRST_HOUR * 60;
+    for (int i = 1; i <= scale.matches; i++) {
+        int stage = rng() % 3;
+        const vector<int>& pool = playersByStage[stage].size() >= 2 ? playersByStage[stage] : playersByStage[0];
+        int p1 = pool[rng() % pool.size()];
+        int p2 = pool[rng() % pool.size()];
+        if (p1 == p2) p2 = pool[(find(pool.begin(), pool.end(), p1) - pool.begin() + 1) % pool.size()];
+        int round = rng() % 4 + 1;
+        bool waiting = rng() % 10 < 7;
+        int slot = (i - 1) / 3;
+        MatchTime time = firstDay + (slot / 12) * 24 * 60 + (slot % 12) * 60;
+        buffer += makeId("M", i, 5) + "," + stages[stage] + "," + makeId("R", round, 3) + ","
+                + benchPlayerId(p1) + "," + benchPlayerId(p2) + "," + formatMatchTime(time) + ","
+                + (waiting ? "waiting" : "completed") + "," + stageCourts[stage] + "\n";
+    }
+    ofstream("Matches.txt") << buffer;
+
+    // Match history over three seasons
+    buffer.clear();
+    for (int i = 1; i <= scale.history; i++) {
+        int p1 = rng() % scale.players + 1;
+        int p2 = rng() % scale.players + 1;
+        if (p1 == p2) p2 = p1 % scale.players + 1;
+        int loserScore = rng() % 10;
+        string score = rng() % 2 ? "11-" + to_string(loserScore) : to_string(loserScore) + "-11";
+        int day = rng() % 28 + 1;
+        int month = rng() % 12 + 1;
+        int year = 2023 + rng() % 3;
+        int hour = DAY_FIRST_HOUR + rng() % SLOTS_PER_DAY;
+        int match = rng() % max(scale.matches, 1) + 1;
+        int stage = rng() % 3;
+        int minutes = 10 + rng() % 50;
+        buffer += makeId("H", i, 6) + "," + makeId("M", match, 5) + "," + stages[stage] + ","
+                + benchPlayerId(p1) + "," + benchPlayerId(p2) + "," + score + ","
+                + formatMatchTime(makeMatchTime(day, month, year, hour)) + ",01:" + to_string(minutes) + "\n";
+    }
+    ofstream("MatchHistory.txt") << buffer;
+
+    // Withdrawals spread over the tournament fortnight
+    buffer.clear();
+    for (int i = 1; i <= scale.withdrawals; i++) {
+        int player = rng() % scale.players + 1;
+        const string& reason = reasons[rng() % 5];
+        int day = rng() % 14 + 15;
+        int hour = rng() % 24;
+        int minute = rng() % 60;
+        int second = rng() % 60;
+        char time[32];
+        snprintf(time, sizeof(time), "2025-04-%02d %02d:%02d:%02d", day, hour, minute, second);
+        buffer += makeId("W", i, 4) + "," + benchPlayerId(player) + ",Player " + to_string(player) + ","
+                + reason + "," + time + "\n";
+    }
+    ofstream("Withdrawals.txt") << buffer;
+}
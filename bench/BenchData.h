@@ -0,0 +1,28 @@
+#ifndef BENCH_BENCHDATA_H
+#define BENCH_BENCHDATA_H
+
+#include "core/Common.h"
+
+// Size of a generated data set
+struct BenchScale {
+    int players;        // Players.txt
+    int matches;        // Matches.txt
+    int history;        // MatchHistory.txt
+    int withdrawals;    // Withdrawals.txt
+};
+
+// Base data set, multiplied by the --scale factor of the benchmark driver
+const BenchScale BENCH_BASE_SCALE = {1000, 2000, 10000, 1000};
+
+/**
+ * Write a deterministic data set in the current directory
+ * (Players.txt, Court.txt, Matches.txt, MatchHistory.txt and Withdrawals.txt)
+ * @param scale the number of records of each file
+ * @param seed the random seed, the same seed always gives the same files
+ */
+void generateBenchData(const BenchScale& scale, unsigned seed);
+
+// ID of the n-th generated player (1-based), e.g. APUTCP00042
+string benchPlayerId(int number);
+
+#endif
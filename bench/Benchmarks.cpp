@@ -0,0 +1,321 @@
+#include "BenchData.h"
+#include "core/Scheduling.h"
+#include "core/Ticketing.h"
+#include "core/Withdrawals.h"
+#include "core/Logger.h"
+#include "core/EventLog.h"
+#include "core/HistoryScan.h"
+
+#include <functional>
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------
+ * ------------------------------------------------ Benchmark Suite -----------------------------------------------
+ * ----------------------------------------------------------------------------------------------------------------
+ * Usage: tournament_bench [--scale N] [--min-time MS] [--seed N] [--filter TEXT] [--generate-only] [--verbose]
+ * The data set is generated in the current directory before the benchmarks run.
+ * Logging runs in quiet mode unless --verbose is given, so only the work itself is timed.
+ */
+
+// Stream buffer that drops everything, so console output does not count towards the timings
+class NullBuffer : public streambuf {
+    protected:
+        int overflow(int c) override { return c; }
+};
+
+// Timing of one benchmark
+struct BenchResult {
+    string name;
+    int iterations;
+    double totalMs;
+    long long items;    // Items processed over all iterations
+};
+
+/**
+ * Runs each benchmark until it has used the minimum time, with cout and cerr silenced
+ */
+class BenchRunner {
+    private:
+        double minTimeMs;
+        string filter;
+        vector<BenchResult> results;
+        NullBuffer nullBuffer;
+
+    public:
+        BenchRunner(double minTime, const string& nameFilter) : minTimeMs(minTime), filter(nameFilter) {}
+
+        /**
+         * Time a benchmark
+         * @param name the benchmark name (group/operation)
+         * @param body one iteration, returns the number of items it processed
+         */
+        void run(const string& name, const function<long long()>& body) {
+            if (!filter.empty() && name.find(filter) == string::npos) return;
+
+            streambuf* coutBuffer = cout.rdbuf(&nullBuffer);
+            streambuf* cerrBuffer = cerr.rdbuf(&nullBuffer);
+            BenchResult result{name, 0, 0.0, 0};
+            auto start = chrono::steady_clock::now();
+            do {
+                result.items += body();
+                result.iterations++;
+                result.totalMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+            } while (result.totalMs < minTimeMs);
+            cout.rdbuf(coutBuffer);
+            cerr.rdbuf(cerrBuffer);
+
+            results.push_back(result);
+            cout << left << setw(36) << name << right << setw(8) << result.iterations
+                 << setw(14) << fixed << setprecision(3) << result.totalMs / result.iterations
+                 << setw(16) << setprecision(0) << (result.totalMs > 0 ? result.items * 1000.0 / result.totalMs : 0.0)
+                 << endl;
+        }
+
+        void printHeader() const {
+            cout << left << setw(36) << "Benchmark" << right << setw(8) << "Iters"
+                 << setw(14) << "ms/iter" << setw(16) << "items/s" << endl;
+            cout << string(74, '-') << endl;
+        }
+
+        int count() const { return results.size(); }
+};
+
+// Results that would otherwise be unused are stored here, so the optimiser cannot drop the work
+static volatile long long benchSink;
+
+/**
+ * Copy a file, so benchmarks that rewrite a file always start from the generated one
+ * @param from the source file
+ * @param to the destination file
+ */
+static void copyFile(const string& from, const string& to) {
+    ifstream in(from, ios::binary);
+    ofstream out(to, ios::binary);
+    out << in.rdbuf();
+}
+
+/**
+ * Register and run the whole suite
+ * @param runner the benchmark runner
+ * @param scale the generated data set
+ */
+static void runSuite(BenchRunner& runner, const BenchScale& scale) {
+    // Match history
+    runner.run("history/readMatches", []() {
+        vector<matchHistory> matches;
+        readMatches("MatchHistory.txt", matches);
+        return (long long)matches.size();
+    });
+    runner.run("history/playerPerformance", []() {
+        vector<matchHistory> matches;
+        readMatches("MatchHistory.txt", matches);
+        long long played = 0;
+        for (const matchHistory& match : matches) {
+            if (match.p1Id == "APUTCP00091" || match.p2Id == "APUTCP00091") played++;
+        }
+        benchSink = played;
+        return (long long)matches.size();
+    });
+    runner.run("history/streamStats", []() {
+        map<string, int> stageMatches;
+        return scanHistoryFile("MatchHistory.txt", [&](const HistoryRowView& row) {
+            stageMatches[string(row.stageID)]++;
+            return true;
+        });
+    });
+    runner.run("history/streamSearchNewest", []() {
+        long long found = 0;
+        scanHistoryFile("MatchHistory.txt", [&](const HistoryRowView& row) {
+            if (row.p1ID == "APUTCP00091" || row.p2ID == "APUTCP00091") found++;
+            return true;
+        }, true);
+        return found;
+    });
+    runner.run("history/winRateBoard", []() {
+        WinRateBoard board;
+        return (long long)board.loadFromHistory("MatchHistory.txt");
+    });
+    runner.run("history/ratingEngine", []() {
+        RatingEngine ratings;
+        return (long long)ratings.recomputeFromHistory("MatchHistory.txt");
+    });
+
+    // Scheduling
+    runner.run("scheduling/loadScheduler", [&scale]() {
+        TournamentScheduler scheduler;
+        return (long long)scale.matches;
+    });
+    runner.run("scheduling/rankedTree", [&scale]() {
+        RankedTree<pair<int, int>> tree;
+        long long rankSum = 0;
+        for (int i = 0; i < scale.history; i++) tree.insert(make_pair((i * 7919) % scale.history, i));
+        for (int i = 0; i < scale.history; i++) rankSum += tree.rankOf(make_pair(i, 0));
+        benchSink = rankSum;
+        return (long long)scale.history * 2;
+    });
+
+    // Ticketing
+    runner.run("ticketing/seatAllocation", []() {
+        CourtSeatMap seats;
+        seats.addSection("Lower", 40, 60);
+        seats.addSection("Upper", 60, 90);
+        vector<vector<SeatBlock>> parties;
+        long long count = 0;
+        for (int party = 1; ; party = party % 6 + 1) {
+            vector<SeatBlock> blocks = seats.allocate(party);
+            if (blocks.empty()) break;
+            parties.push_back(blocks);
+            count++;
+        }
+        for (const vector<SeatBlock>& blocks : parties) seats.release(blocks);
+        return count * 2;
+    });
+
+    runner.run("ticketing/ticketQueueAndGates", []() {
+        TicketingContext context;
+        loadSeatMaps(context);
+        const int spectators = 300;
+        const char* ticketTypes[] = {"VIP", "Early-Bird", "General"};
+        for (int i = 0; i < spectators; i++) {
+            string courtID = DEFAULT_COURTS[i % NUM_COURTS].courtID;
+            int seats = i % 4 + 1;
+            Spectator* spectator = new Spectator{"Spectator " + to_string(i), ticketTypes[i % 3], 0, "", courtID, seats,
+                                                 "M00001", "28-04-2025 07:00", nullptr, {0}, {}, "", NO_HOLD};
+            spectator -> priority = getPriority(spectator -> ticketType);
+            spectator -> holdID = context.seatHolds.place(courtID, seats);
+            enqueuePriorityQueue(context, spectator);
+        }
+        processTicketQueue(context);
+
+        long long requests = 0;
+        for (Node* node = context.spectatorList; node; node = node -> next) {
+            enqueueGateRequest(context, node -> spectator -> ticketID, true);
+            requests++;
+        }
+        processGateRequests(context);
+        return spectators + requests;
+    });
+
+    // Withdrawals
+    runner.run("withdrawals/loadAndQuery", [&scale]() {
+        PlayerWithdrawals withdrawals("Withdrawals.txt");
+        long long found = 0;
+        for (int i = 1; i <= scale.players; i++) found += withdrawals.findByPlayer(benchPlayerId(i), 1, 10).total;
+        found += withdrawals.findByReason("injury", 1, 10).total;
+        found += withdrawals.findByTimeWindow("2025-04-20", "2025-04-22", 1, 10).total;
+        benchSink = found;
+        return (long long)withdrawals.size() + scale.players + 2;
+    });
+    runner.run("withdrawals/substitution", [&scale]() {
+        copyFile("Matches.txt", "Matches_bench.txt");
+        SubstitutionEngine engine;
+        engine.load("Players.txt", "Matches_bench.txt", "Withdrawals.txt");
+        vector<string> withdrawn;
+        for (int i = 1; i <= scale.players; i += 20) withdrawn.push_back(benchPlayerId(i));
+        long long count = engine.substitute(withdrawn).size();
+        engine.save("Matches_bench.txt");
+        return count;
+    });
+    remove("Matches_bench.txt");
+
+    // Event log: one record per append (one write and flush each), then a full replay of what was written
+    vector<EventPayload> events;
+    for (int i = 1; i <= scale.matches; i++) {
+        string matchID = "M" + to_string(i);
+        string p1 = benchPlayerId(i % scale.players + 1), p2 = benchPlayerId((i * 7) % scale.players + 1);
+        events.push_back(MatchScheduledEvent{matchID, "S001", "R001", p1, p2, tournamentStart() + DAY_FIRST_HOUR * 60, "waiting", "C001"});
+        events.push_back(TicketSoldEvent{"T" + to_string(i), "Spectator " + to_string(i), "General", "C001", matchID, i % 4 + 1, "Purchased", ""});
+        events.push_back(ResultRecordedEvent{matchID, "S001", p1, p2, 6, i % 5, tournamentStart() + DAY_FIRST_HOUR * 60, "45:00"});
+    }
+    remove("Events_bench.log");
+    remove("Events_bench.log.snapshot");
+    {
+        EventLog eventLog("Events_bench.log", 0);
+        runner.run("eventlog/append", [&eventLog, &events]() {
+            for (const EventPayload& event : events) eventLog.append(event);
+            return (long long)events.size();
+        });
+    }
+    runner.run("eventlog/replay", []() {
+        TournamentState state;
+        uint64_t validEnd;
+        return EventLog::replay("Events_bench.log", 0, INT64_MAX, state, validEnd);
+    });
+    remove("Events_bench.log");
+
+    // Persistence: back-to-back rewrites of a Matches.txt-sized file, as a run of menu saves does.
+    // caller is the time the saving thread is held up; durable waits for the last write to reach disk.
+    // Compare with TOURNAMENT_ASYNC_WRITES=off for the blocking writes.
+    string matchesText;
+    {
+        ifstream matchesFile("Matches.txt", ios::binary);
+        matchesText.assign(istreambuf_iterator<char>(matchesFile), istreambuf_iterator<char>());
+    }
+    const int rewrites = 50;
+    runner.run("persistence/rewrite(caller)", [&matchesText]() {
+        for (int i = 0; i < rewrites; i++) AsyncFileWriter::instance().rewrite("Matches_bench.txt", matchesText);
+        return (long long)rewrites;
+    });
+    syncFile("Matches_bench.txt");
+    runner.run("persistence/rewrite(durable)", [&matchesText]() {
+        WriteHandle last;
+        for (int i = 0; i < rewrites; i++) last = AsyncFileWriter::instance().rewrite("Matches_bench.txt", matchesText);
+        last.wait();
+        return (long long)rewrites;
+    });
+    remove("Matches_bench.txt");
+}
+
+int main(int argc, char* argv[]) {
+    int scaleFactor = 1;
+    double minTimeMs = 200;
+    unsigned seed = 2025;
+    string filter;
+    bool generateOnly = false;
+    bool verbose = false;
+
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--scale" && hasValue) {
+            scaleFactor = max(1, atoi(argv[++i]));
+        } else if (arg == "--min-time" && hasValue) {
+            minTimeMs = max(0.0, atof(argv[++i]));
+        } else if (arg == "--seed" && hasValue) {
+            seed = strtoul(argv[++i], nullptr, 10);
+        } else if (arg == "--filter" && hasValue) {
+            filter = argv[++i];
+        } else if (arg == "--generate-only") {
+            generateOnly = true;
+        } else if (arg == "--verbose") {
+            verbose = true;
+        } else {
+            cerr << "Usage: " << argv[0] << " [--scale N] [--min-time MS] [--seed N] [--filter TEXT] [--generate-only] [--verbose]" << endl;
+            return 2;
+        }
+    }
+
+    BenchScale scale = BENCH_BASE_SCALE;
+    scale.players *= scaleFactor;
+    scale.matches *= scaleFactor;
+    scale.history *= scaleFactor;
+    scale.withdrawals *= scaleFactor;
+
+    cout << "Generating data (scale " << scaleFactor << ", seed " << seed << "): " << scale.players << " players, "
+         << scale.matches << " matches, " << scale.history << " history records, "
+         << scale.withdrawals << " withdrawals" << endl;
+    generateBenchData(scale, seed);
+    if (generateOnly) return 0;
+
+    Logger::instance().setQuiet(!verbose);
+    // The benchmarks would otherwise fill the program's event log; the event log benchmarks use their own
+    EventLog::instance().setEnabled(false);
+    BenchRunner runner(minTimeMs, filter);
+    runner.printHeader();
+    runSuite(runner, scale);
+    if (runner.count() == 0) {
+        cerr << "No benchmark matches '" << filter << "'." << endl;
+        return 1;
+    }
+    return 0;
+}
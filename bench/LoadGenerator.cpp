@@ -0,0 +1,507 @@
+#include "server/Client.h"
+#include "core/Ticketing.h"
+#include "core/Logger.h"
+#include "core/EventLog.h"
+
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------
+ * ------------------------------------------------ Load Generator ------------------------------------------------
+ * ----------------------------------------------------------------------------------------------------------------
+ * Usage: tournament_loadgen [--target inprocess|socket] [--socket PATH] [--mode closed|open] [--concurrency N]
+ *                           [--rate PER_SECOND] [--duration SECONDS] [--think MS] [--gate-ratio F]
+ *                           [--mix VIP:1,Early-bird:2,General:7] [--party 1:4,2:3,4:2,8:1] [--match-skew S]
+ *                           [--seed N] [--no-event-log] [--verbose]
+ *
+ * Drives ticket sales (sellTicket: seat hold, ticket queue, sale) and gate passes (passThroughGate) either
+ * in this process, against one ticketing session behind a lock as in the server, or through a running
+ * tournament_server on its socket. Run it in the directory of the tournament files: the ticketable
+ * matches are read from Matches.txt.
+ *
+ * Closed loop: --concurrency users each send a request, wait for the response and think for --think ms
+ *   (exponentially distributed) before the next one.
+ * Open loop: requests arrive as a Poisson process at --rate per second and --concurrency workers serve
+ *   them; latency is measured from the arrival, so queueing behind a slow system is counted.
+ *
+ * Each request is a gate pass with probability --gate-ratio (when a sold ticket is free to use), otherwise
+ * a purchase. Ticket types and party sizes follow the weighted mixes; matches are picked uniformly, or with
+ * Zipf weights 1/rank^S for --match-skew S > 0 so a few matches are hot.
+ *
+ * In-process runs continue the ticketing session recorded in the event log, so courts sold out by earlier
+ * runs stay sold out; --no-event-log starts from an empty session and records nothing.
+ */
+
+// Stream buffer that drops everything, so console output does not count towards the latencies
+class NullBuffer : public streambuf {
+    protected:
+        int overflow(int c) override { return c; }
+};
+
+enum LoadOperation { LOAD_PURCHASE, LOAD_GATE, LOAD_OPERATIONS };
+
+enum LoadOutcome { LOAD_OK, LOAD_REJECTED, LOAD_ERROR };
+
+/**
+ * The system under test, as seen by one load thread
+ */
+class LoadSession {
+    public:
+        virtual ~LoadSession() {}
+
+        /**
+         * Buy tickets for a party
+         * @param ticketID Output: the ticket of a purchase
+         */
+        virtual LoadOutcome buy(const string& name, const string& ticketType, const string& matchID, int seats,
+                                string& ticketID) = 0;
+
+        // Pass a ticket holder through the gates
+        virtual LoadOutcome gate(const string& ticketID, bool isEntry) = 0;
+};
+
+// One ticketing session shared by the in-process load threads
+struct SharedTicketing {
+    mutex lock;
+    TicketingContext context;
+
+    SharedTicketing() {
+        loadSeatMaps(context);
+        restoreTicketing(context, EventLog::instance().state());
+    }
+};
+
+class InProcessSession : public LoadSession {
+    private:
+        SharedTicketing& ticketing;
+
+    public:
+        InProcessSession(SharedTicketing& shared) : ticketing(shared) {}
+
+        LoadOutcome buy(const string& name, const string& ticketType, const string& matchID, int seats,
+                        string& ticketID) override {
+            lock_guard<mutex> guard(ticketing.lock);
+            ticketing.context.ticketableMatches.refresh();
+            const Match* match = ticketing.context.ticketableMatches.find(matchID);
+            if (match == nullptr) return LOAD_ERROR;
+            Spectator* spectator = sellTicket(ticketing.context, name, ticketType, *match, seats);
+            if (spectator == nullptr) return LOAD_REJECTED;
+            ticketID = spectator -> ticketID;
+            return LOAD_OK;
+        }
+
+        LoadOutcome gate(const string& ticketID, bool isEntry) override {
+            lock_guard<mutex> guard(ticketing.lock);
+            return passThroughGate(ticketing.context, ticketID, isEntry) ? LOAD_OK : LOAD_REJECTED;
+        }
+};
+
+class SocketSession : public LoadSession {
+    private:
+        ServerClient client;
+
+    public:
+        bool connect(const string& path) { return client.connect(path); }
+
+        LoadOutcome buy(const string& name, const string& ticketType, const string& matchID, int seats,
+                        string& ticketID) override {
+            Message response;
+            if (!client.call(OP_BUY_TICKET, {name, ticketType, matchID, to_string(seats)}, response)
+                || response.code != STATUS_OK || response.fields.size() < 2) {
+                return LOAD_ERROR;
+            }
+            if (response.fields[0] != "Purchased") return LOAD_REJECTED;
+            ticketID = response.fields[1];
+            return LOAD_OK;
+        }
+
+        LoadOutcome gate(const string& ticketID, bool isEntry) override {
+            Message response;
+            if (!client.call(OP_GATE, {ticketID, isEntry ? "entry" : "exit"}, response)
+                || response.code != STATUS_OK || response.fields.empty()) {
+                return LOAD_ERROR;
+            }
+            return response.fields[0] == "Passed" ? LOAD_OK : LOAD_REJECTED;
+        }
+};
+
+struct LoadConfig {
+    string target = "inprocess";
+    string socketPath = "tournament.sock";
+    bool openLoop = false;
+    int concurrency = 8;
+    double rate = 1000;             // Open loop arrivals per second
+    double durationSeconds = 10;
+    double thinkMs = 0;             // Closed loop mean think time
+    double gateRatio = 0.5;
+    vector<pair<string, double>> ticketTypes = {{"VIP", 1}, {"Early-bird", 2}, {"General", 7}};
+    vector<pair<string, double>> partySizes = {{"1", 4}, {"2", 3}, {"4", 2}, {"8", 1}};
+    double matchSkew = 0;
+    unsigned seed = 2025;
+};
+
+// Measurements of one operation
+struct LoadStats {
+    vector<int64_t> latencies;      // Nanoseconds, one per request
+    long long rejected = 0;
+    long long errors = 0;
+
+    void add(const LoadStats& other) {
+        latencies.insert(latencies.end(), other.latencies.begin(), other.latencies.end());
+        rejected += other.rejected;
+        errors += other.errors;
+    }
+};
+
+// A sold ticket the load threads pass through the gates
+struct HeldTicket {
+    string ticketID;
+    bool inside;
+};
+
+/**
+ * Workload shared by the load threads: the request mix and the sold tickets
+ */
+class LoadWorkload {
+    private:
+        const LoadConfig& config;
+        vector<string> matchIDs;
+        vector<double> matchWeights;
+        mutex ticketMutex;
+        vector<HeldTicket> tickets;     // Tickets not in use by a thread
+
+        static vector<double> weightsOf(const vector<pair<string, double>>& mix) {
+            vector<double> weights;
+            for (const auto& entry : mix) weights.push_back(entry.second);
+            return weights;
+        }
+
+    public:
+        LoadWorkload(const LoadConfig& loadConfig, const vector<string>& matches, mt19937& rng)
+            : config(loadConfig), matchIDs(matches) {
+            // Hot matches are spread over the courts rather than taken in file order
+            shuffle(matchIDs.begin(), matchIDs.end(), rng);
+            for (size_t i = 0; i < matchIDs.size(); i++) matchWeights.push_back(1.0 / pow(i + 1.0, config.matchSkew));
+        }
+
+        // Per-thread choosers (distributions are not shared between threads)
+        struct Chooser {
+            mt19937 rng;
+            discrete_distribution<int> ticketType;
+            discrete_distribution<int> partySize;
+            discrete_distribution<int> match;
+            uniform_real_distribution<double> unit;
+            long long requests;
+        };
+
+        Chooser chooser(unsigned threadSeed) const {
+            vector<double> typeWeights = weightsOf(config.ticketTypes);
+            vector<double> partyWeights = weightsOf(config.partySizes);
+            return Chooser{mt19937(threadSeed),
+                           discrete_distribution<int>(typeWeights.begin(), typeWeights.end()),
+                           discrete_distribution<int>(partyWeights.begin(), partyWeights.end()),
+                           discrete_distribution<int>(matchWeights.begin(), matchWeights.end()),
+                           uniform_real_distribution<double>(0.0, 1.0), 0};
+        }
+
+        /**
+         * Pick the next request and send it
+         * @param session the thread's session
+         * @param choose the thread's choosers
+         * @param name prefix of the spectator names
+         * @param outcome Output: the outcome
+         * @return the operation sent
+         */
+        LoadOperation send(LoadSession& session, Chooser& choose, const string& name, LoadOutcome& outcome) {
+            if (choose.unit(choose.rng) < config.gateRatio) {
+                HeldTicket ticket;
+                bool found = false;
+                {
+                    lock_guard<mutex> lock(ticketMutex);
+                    if (!tickets.empty()) {
+                        size_t index = uniform_int_distribution<size_t>(0, tickets.size() - 1)(choose.rng);
+                        swap(tickets[index], tickets.back());
+                        ticket = tickets.back();
+                        tickets.pop_back();
+                        found = true;
+                    }
+                }
+                if (found) {
+                    outcome = session.gate(ticket.ticketID, !ticket.inside);
+                    if (outcome == LOAD_OK) ticket.inside = !ticket.inside;
+                    lock_guard<mutex> lock(ticketMutex);
+                    tickets.push_back(ticket);
+                    return LOAD_GATE;
+                }
+            }
+
+            string ticketID;
+            outcome = session.buy(name + "-" + to_string(++choose.requests), config.ticketTypes[choose.ticketType(choose.rng)].first,
+                                  matchIDs[choose.match(choose.rng)], stoi(config.partySizes[choose.partySize(choose.rng)].first),
+                                  ticketID);
+            if (outcome == LOAD_OK) {
+                lock_guard<mutex> lock(ticketMutex);
+                tickets.push_back(HeldTicket{ticketID, false});
+            }
+            return LOAD_PURCHASE;
+        }
+};
+
+// Measurements and state of one load thread
+struct LoadThread {
+    unique_ptr<LoadSession> session;
+    LoadWorkload::Chooser choose;
+    LoadStats stats[LOAD_OPERATIONS];
+
+    void record(LoadOperation operation, LoadOutcome outcome, chrono::steady_clock::time_point start) {
+        LoadStats& target = stats[operation];
+        target.latencies.push_back(chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count());
+        if (outcome == LOAD_REJECTED) target.rejected++;
+        if (outcome == LOAD_ERROR) target.errors++;
+    }
+};
+
+/**
+ * Parse a weighted mix e.g. VIP:1,General:3
+ * @param text the mix
+ * @param mix Output: the values and weights
+ * @return True if every entry has a value and a positive weight, else False
+ */
+static bool parseMix(const string& text, vector<pair<string, double>>& mix) {
+    mix.clear();
+    stringstream ss(text);
+    string entry;
+    while (getline(ss, entry, ',')) {
+        size_t colon = entry.rfind(':');
+        double weight = colon == string::npos ? 1.0 : atof(entry.c_str() + colon + 1);
+        string value = entry.substr(0, colon);
+        if (value.empty() || weight <= 0) return false;
+        mix.push_back({value, weight});
+    }
+    return !mix.empty();
+}
+
+// Latency percentile of sorted nanoseconds, in microseconds
+static double percentileUs(const vector<int64_t>& sorted, double fraction) {
+    if (sorted.empty()) return 0;
+    size_t rank = (size_t)ceil(fraction * sorted.size());
+    return sorted[min(sorted.size() - 1, rank == 0 ? 0 : rank - 1)] / 1000.0;
+}
+
+static void printStats(const string& name, LoadStats& stats, double elapsedSeconds) {
+    sort(stats.latencies.begin(), stats.latencies.end());
+    size_t count = stats.latencies.size();
+    cout << left << setw(10) << name << right << setw(10) << count
+         << setw(12) << fixed << setprecision(0) << (elapsedSeconds > 0 ? count / elapsedSeconds : 0.0)
+         << setw(10) << setprecision(2) << (count > 0 ? 100.0 * stats.rejected / count : 0.0)
+         << setw(8) << stats.errors
+         << setw(10) << setprecision(1) << percentileUs(stats.latencies, 0.50)
+         << setw(10) << percentileUs(stats.latencies, 0.99)
+         << setw(10) << percentileUs(stats.latencies, 0.999)
+         << setw(10) << (count > 0 ? stats.latencies.back() / 1000.0 : 0.0) << endl;
+}
+
+static void printUsage(const char* program) {
+    cerr << "Usage: " << program << " [--target inprocess|socket] [--socket PATH] [--mode closed|open] [--concurrency N]\n"
+         << "       [--rate PER_SECOND] [--duration SECONDS] [--think MS] [--gate-ratio F]\n"
+         << "       [--mix VIP:1,Early-bird:2,General:7] [--party 1:4,2:3,4:2,8:1] [--match-skew S]\n"
+         << "       [--seed N] [--no-event-log] [--verbose]" << endl;
+}
+
+int main(int argc, char* argv[]) {
+    LoadConfig config;
+    bool eventLog = true;
+    bool verbose = false;
+
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        bool valid = true;
+        if (arg == "--target" && hasValue) {
+            config.target = argv[++i];
+            valid = config.target == "inprocess" || config.target == "socket";
+        } else if (arg == "--socket" && hasValue) {
+            config.socketPath = argv[++i];
+        } else if (arg == "--mode" && hasValue) {
+            string mode = argv[++i];
+            config.openLoop = mode == "open";
+            valid = mode == "open" || mode == "closed";
+        } else if (arg == "--concurrency" && hasValue) {
+            config.concurrency = max(1, atoi(argv[++i]));
+        } else if (arg == "--rate" && hasValue) {
+            config.rate = atof(argv[++i]);
+            valid = config.rate > 0;
+        } else if (arg == "--duration" && hasValue) {
+            config.durationSeconds = max(0.1, atof(argv[++i]));
+        } else if (arg == "--think" && hasValue) {
+            config.thinkMs = max(0.0, atof(argv[++i]));
+        } else if (arg == "--gate-ratio" && hasValue) {
+            config.gateRatio = min(1.0, max(0.0, atof(argv[++i])));
+        } else if (arg == "--mix" && hasValue) {
+            valid = parseMix(argv[++i], config.ticketTypes);
+            for (const auto& entry : config.ticketTypes) {
+                valid = valid && (entry.first == "VIP" || entry.first == "Early-bird" || entry.first == "General");
+            }
+        } else if (arg == "--party" && hasValue) {
+            valid = parseMix(argv[++i], config.partySizes);
+            for (const auto& entry : config.partySizes) valid = valid && atoi(entry.first.c_str()) > 0;
+        } else if (arg == "--match-skew" && hasValue) {
+            config.matchSkew = max(0.0, atof(argv[++i]));
+        } else if (arg == "--seed" && hasValue) {
+            config.seed = strtoul(argv[++i], nullptr, 10);
+        } else if (arg == "--no-event-log") {
+            eventLog = false;
+        } else if (arg == "--verbose") {
+            verbose = true;
+        } else {
+            valid = false;
+        }
+        if (!valid) {
+            printUsage(argv[0]);
+            return 2;
+        }
+    }
+    bool inProcess = config.target == "inprocess";
+
+    // The core's console messages are dropped while the matches load and the load runs
+    NullBuffer nullBuffer;
+    streambuf* coutBuffer = cout.rdbuf();
+    if (!verbose) cout.rdbuf(&nullBuffer);
+
+    TicketableMatchCache ticketable("Matches.txt");
+    ticketable.refresh();
+    vector<string> matchIDs;
+    for (int i = 0; i < ticketable.size(); i++) matchIDs.push_back(ticketable.at(i).matchID);
+    if (matchIDs.empty()) {
+        cerr << "Error: no ticketable matches in Matches.txt" << endl;
+        cout.rdbuf(coutBuffer);
+        return 1;
+    }
+
+    if (!verbose) Logger::instance().setQuiet(true);
+    if (!eventLog) EventLog::instance().setEnabled(false);
+    unique_ptr<SharedTicketing> shared;
+    if (inProcess) shared.reset(new SharedTicketing());
+
+    mt19937 rng(config.seed);
+    LoadWorkload workload(config, matchIDs, rng);
+    vector<LoadThread> threads(config.concurrency);
+    for (int i = 0; i < config.concurrency; i++) {
+        threads[i].choose = workload.chooser(config.seed + 1 + i);
+        if (inProcess) {
+            threads[i].session.reset(new InProcessSession(*shared));
+        } else {
+            SocketSession* session = new SocketSession();
+            threads[i].session.reset(session);
+            if (!session -> connect(config.socketPath)) {
+                cerr << "Error: cannot connect to " << config.socketPath << endl;
+                cout.rdbuf(coutBuffer);
+                return 1;
+            }
+        }
+    }
+
+    cout.rdbuf(coutBuffer);
+    cout << (config.openLoop ? "Open" : "Closed") << " loop, " << (inProcess ? "in-process" : "socket " + config.socketPath)
+         << ", " << config.concurrency << (config.openLoop ? " workers" : " users") << ", "
+         << config.durationSeconds << " s, " << matchIDs.size() << " ticketable matches";
+    if (config.openLoop) cout << ", " << config.rate << " arrivals/s";
+    cout << endl;
+
+    if (!verbose) cout.rdbuf(&nullBuffer);
+
+    auto start = chrono::steady_clock::now();
+    auto end = start + chrono::duration_cast<chrono::steady_clock::duration>(chrono::duration<double>(config.durationSeconds));
+    vector<thread> runners;
+    long long arrivals = 0, unsent = 0;
+
+    if (!config.openLoop) {
+        for (int i = 0; i < config.concurrency; i++) {
+            runners.emplace_back([&, i]() {
+                LoadThread& self = threads[i];
+                string name = "Load " + to_string(i);
+                exponential_distribution<double> think(config.thinkMs > 0 ? 1.0 / config.thinkMs : 1.0);
+                while (chrono::steady_clock::now() < end) {
+                    LoadOutcome outcome;
+                    auto sent = chrono::steady_clock::now();
+                    LoadOperation operation = workload.send(*self.session, self.choose, name, outcome);
+                    self.record(operation, outcome, sent);
+                    if (config.thinkMs > 0) this_thread::sleep_for(chrono::duration<double, milli>(think(self.choose.rng)));
+                }
+            });
+        }
+        for (thread& runner : runners) runner.join();
+    } else {
+        // Arrivals are queued with their arrival time; the workers stop taking them when the run ends
+        mutex arrivalMutex;
+        condition_variable arrivalReady;
+        deque<chrono::steady_clock::time_point> pending;
+        bool finished = false;
+        for (int i = 0; i < config.concurrency; i++) {
+            runners.emplace_back([&, i]() {
+                LoadThread& self = threads[i];
+                string name = "Load " + to_string(i);
+                while (true) {
+                    chrono::steady_clock::time_point arrival;
+                    {
+                        unique_lock<mutex> lock(arrivalMutex);
+                        arrivalReady.wait(lock, [&]() { return finished || !pending.empty(); });
+                        if (finished) return;
+                        arrival = pending.front();
+                        pending.pop_front();
+                    }
+                    LoadOutcome outcome;
+                    LoadOperation operation = workload.send(*self.session, self.choose, name, outcome);
+                    self.record(operation, outcome, arrival);
+                }
+            });
+        }
+
+        exponential_distribution<double> gap(config.rate);
+        auto next = start;
+        while (true) {
+            next += chrono::duration_cast<chrono::steady_clock::duration>(chrono::duration<double>(gap(rng)));
+            if (next >= end) break;
+            this_thread::sleep_until(next);
+            {
+                lock_guard<mutex> lock(arrivalMutex);
+                pending.push_back(next);
+            }
+            arrivalReady.notify_one();
+            arrivals++;
+        }
+        this_thread::sleep_until(end);
+        {
+            lock_guard<mutex> lock(arrivalMutex);
+            finished = true;
+            unsent = pending.size();
+        }
+        arrivalReady.notify_all();
+        for (thread& runner : runners) runner.join();
+    }
+    double elapsedSeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    cout.rdbuf(coutBuffer);
+
+    LoadStats totals[LOAD_OPERATIONS];
+    LoadStats all;
+    for (LoadThread& loadThread : threads) {
+        for (int op = 0; op < LOAD_OPERATIONS; op++) totals[op].add(loadThread.stats[op]);
+    }
+    for (int op = 0; op < LOAD_OPERATIONS; op++) all.add(totals[op]);
+
+    cout << left << setw(10) << "Operation" << right << setw(10) << "Count" << setw(12) << "ops/s"
+         << setw(10) << "Reject%" << setw(8) << "Errors" << setw(10) << "p50 us" << setw(10) << "p99 us"
+         << setw(10) << "p999 us" << setw(10) << "max us" << endl;
+    cout << string(90, '-') << endl;
+    printStats("purchase", totals[LOAD_PURCHASE], elapsedSeconds);
+    printStats("gate", totals[LOAD_GATE], elapsedSeconds);
+    printStats("all", all, elapsedSeconds);
+    if (config.openLoop) {
+        cout << "Offered " << fixed << setprecision(0) << arrivals / config.durationSeconds << " arrivals/s; "
+             << unsent << " arrivals were still queued when the run ended" << endl;
+    }
+    return 0;
+}
@@ -0,0 +1,143 @@
+#include "AsyncWriter.h"
+#include "Instrumentation.h"
+#include "Logger.h"
+
+/** ---- Write handles ---- */
+
+bool WriteHandle::isDone() const {
+    if (!completion) return true;
+    lock_guard<mutex> lock(completion -> lock);
+    return completion -> finished;
+}
+
+bool WriteHandle::wait() const {
+    if (!completion) return true;
+    unique_lock<mutex> lock(completion -> lock);
+    completion -> done.wait(lock, [this]() { return completion -> finished; });
+    return completion -> succeeded;
+}
+
+// Mark a write finished and wake its waiters
+static void complete(const shared_ptr<WriteCompletion>& completion, bool succeeded) {
+    {
+        lock_guard<mutex> lock(completion -> lock);
+        completion -> finished = true;
+        completion -> succeeded = succeeded;
+    }
+    completion -> done.notify_all();
+}
+
+/** ---- Writer ---- */
+
+AsyncFileWriter::AsyncFileWriter() : stopping(false) {
+    const char* mode = getenv("TOURNAMENT_ASYNC_WRITES");
+    async = !(mode && string(mode) == "off");
+    // The logger must outlive the I/O thread, which reports failed writes until the end
+    Logger::instance();
+    if (async) worker = thread(&AsyncFileWriter::run, this);
+}
+
+AsyncFileWriter& AsyncFileWriter::instance() {
+    static AsyncFileWriter writer;
+    return writer;
+}
+
+AsyncFileWriter::~AsyncFileWriter() {
+    if (!worker.joinable()) return;
+    {
+        lock_guard<mutex> lock(jobMutex);
+        stopping = true;
+    }
+    jobReady.notify_all();
+    worker.join();      // The queue is written out before the thread ends
+}
+
+WriteHandle AsyncFileWriter::submit(const string& filename, string data, bool rewrite) {
+    shared_ptr<WriteCompletion> completion = make_shared<WriteCompletion>();
+    if (!async) {
+        FileJob job{rewrite, move(data), {}};
+        complete(completion, perform(filename, job));
+        return WriteHandle(completion);
+    }
+
+    {
+        lock_guard<mutex> lock(jobMutex);
+        auto it = pending.find(filename);
+        if (it == pending.end()) {
+            pending.emplace(filename, FileJob{rewrite, move(data), {completion}});
+            order.push_back(filename);
+        } else {
+            FileJob& job = it -> second;
+            if (rewrite) {
+                // The waiting contents are superseded, whatever they were
+                job.rewrite = true;
+                job.data = move(data);
+            } else {
+                job.data += data;
+            }
+            job.completions.push_back(completion);
+            INSTRUMENT_COUNT("async writes merged", 1);
+        }
+    }
+    jobReady.notify_one();
+    return WriteHandle(completion);
+}
+
+bool AsyncFileWriter::perform(const string& filename, const FileJob& job) {
+    INSTRUMENT_FILE_SCOPE("AsyncFileWriter::perform");
+    if (!job.rewrite) {
+        ofstream out(filename, ios::app | ios::binary);
+        out << job.data;
+        out.close();
+        if (out.fail()) {
+            LOG_EVENT(LOG_ERROR, "asyncWrite.failed", "Error: could not append to " << filename << ".\n", {"file", filename});
+            return false;
+        }
+        return true;
+    }
+
+    string tempFilename = filename + ".tmp";
+    ofstream out(tempFilename, ios::binary | ios::trunc);
+    out << job.data;
+    out.close();
+    if (out.fail() || rename(tempFilename.c_str(), filename.c_str()) != 0) {
+        remove(tempFilename.c_str());
+        LOG_EVENT(LOG_ERROR, "asyncWrite.failed", "Error: could not write " << filename << ".\n", {"file", filename});
+        return false;
+    }
+    return true;
+}
+
+void AsyncFileWriter::run() {
+    unique_lock<mutex> lock(jobMutex);
+    while (true) {
+        jobReady.wait(lock, [this]() { return stopping || !order.empty(); });
+        if (order.empty()) return;  // Stopping with nothing left to write
+
+        string filename = move(order.front());
+        order.pop_front();
+        FileJob job = move(pending[filename]);
+        pending.erase(filename);
+        writing = filename;
+
+        lock.unlock();
+        bool succeeded = perform(filename, job);
+        for (const shared_ptr<WriteCompletion>& completion : job.completions) complete(completion, succeeded);
+        lock.lock();
+
+        writing.clear();
+        jobFinished.notify_all();
+    }
+}
+
+void AsyncFileWriter::syncFile(const string& filename) {
+    if (!async) return;
+    unique_lock<mutex> lock(jobMutex);
+    jobFinished.wait(lock, [&]() { return writing != filename && pending.find(filename) == pending.end(); });
+}
+
+void AsyncFileWriter::flush() {
+    if (!async) return;
+    unique_lock<mutex> lock(jobMutex);
+    jobFinished.wait(lock, [this]() { return writing.empty() && order.empty(); });
+}
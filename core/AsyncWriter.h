@@ -0,0 +1,126 @@
+#ifndef CORE_ASYNC_WRITER_H
+#define CORE_ASYNC_WRITER_H
+
+#include "Common.h"
+#include <mutex>
+#include <condition_variable>
+#include <memory>
+#include <deque>
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------
+ * -------------------------------------------------- Async Writer ------------------------------------------------
+ * ----------------------------------------------------------------------------------------------------------------
+ * The text files are saved by one background I/O thread, so a menu operation only builds the new contents
+ * and carries on. Writes to a file that has not been written yet are merged: a newer full rewrite replaces
+ * the waiting contents, an append is added to them, and every caller's handle completes with the one write.
+ * Full rewrites go to "<file>.tmp" and are renamed over the file, so readers never see half a file.
+ *
+ * Code that reads a file written here calls syncFile() first, which waits for that file's pending writes.
+ * Everything still queued is written before the program exits.
+ *
+ * Environment: TOURNAMENT_ASYNC_WRITES=off writes on the caller's thread instead.
+ */
+
+// Completion state shared by the handles of one write
+struct WriteCompletion {
+    mutex lock;
+    condition_variable done;
+    bool finished = false;
+    bool succeeded = false;
+};
+
+/**
+ * Handle of a queued write
+ */
+class WriteHandle {
+    private:
+        shared_ptr<WriteCompletion> completion;     // Null for a write that already finished
+
+    public:
+        WriteHandle() {}
+        WriteHandle(const shared_ptr<WriteCompletion>& state) : completion(state) {}
+
+        // Check if the write has finished (whether or not it succeeded)
+        bool isDone() const;
+
+        /**
+         * Wait for the write to finish
+         * @return True if the file was written, else False
+         */
+        bool wait() const;
+};
+
+/**
+ * The background writer of the program
+ */
+class AsyncFileWriter {
+    private:
+        // The merged writes waiting for one file
+        struct FileJob {
+            bool rewrite;           // True: the data replaces the file, False: it is appended
+            string data;
+            vector<shared_ptr<WriteCompletion>> completions;
+        };
+
+        bool async;
+        mutex jobMutex;
+        condition_variable jobReady;
+        condition_variable jobFinished;
+        unordered_map<string, FileJob> pending;
+        deque<string> order;        // Files with pending writes, oldest first
+        string writing;             // File the I/O thread is writing, empty when idle
+        bool stopping;
+        thread worker;
+
+        AsyncFileWriter();
+
+        /**
+         * Queue a write, merging it into the file's waiting write
+         * @return the handle of the write
+         */
+        WriteHandle submit(const string& filename, string data, bool rewrite);
+
+        // Write a job to disk; returns True on success
+        static bool perform(const string& filename, const FileJob& job);
+
+        // I/O thread loop
+        void run();
+
+    public:
+        static AsyncFileWriter& instance();
+        ~AsyncFileWriter();
+        AsyncFileWriter(const AsyncFileWriter&) = delete;
+        AsyncFileWriter& operator=(const AsyncFileWriter&) = delete;
+
+        bool isAsync() const { return async; }
+
+        /**
+         * Replace a file's contents
+         * @param filename the file
+         * @param contents the new contents
+         * @return the handle of the write
+         */
+        WriteHandle rewrite(const string& filename, string contents) { return submit(filename, move(contents), true); }
+
+        /**
+         * Append to a file
+         * @param filename the file
+         * @param data the text to append
+         * @return the handle of the write
+         */
+        WriteHandle append(const string& filename, string data) { return submit(filename, move(data), false); }
+
+        // Wait until the writes queued for a file are on disk
+        void syncFile(const string& filename);
+
+        // Wait until every queued write is on disk
+        void flush();
+};
+
+// Wait until the writes queued for a file are on disk (call before reading the file)
+inline void syncFile(const string& filename) {
+    AsyncFileWriter::instance().syncFile(filename);
+}
+
+#endif
@@ -0,0 +1,71 @@
+#ifndef CORE_BYTE_BUFFER_H
+#define CORE_BYTE_BUFFER_H
+
+#include "Common.h"
+
+/**
+ * Appends fixed-size numbers (host byte order) and length-prefixed strings to a byte buffer.
+ * Used by the event log and the server protocol.
+ */
+class ByteWriter {
+    public:
+        string& bytes;
+
+        ByteWriter(string& buffer) : bytes(buffer) {}
+
+        template <class T> void number(T value) {
+            bytes.append(reinterpret_cast<const char*>(&value), sizeof(value));
+        }
+
+        void text(const string& value) {
+            uint16_t length = min(value.size(), (size_t)UINT16_MAX);
+            number(length);
+            bytes.append(value, 0, length);
+        }
+
+        // Overwrite a number written earlier (e.g. a length known only at the end)
+        template <class T> void patch(size_t offset, T value) {
+            memcpy(&bytes[offset], &value, sizeof(value));
+        }
+};
+
+/**
+ * Reads what a ByteWriter wrote; a read past the end clears good() instead of throwing
+ */
+class ByteReader {
+    private:
+        const char* data;
+        size_t size;
+        size_t position;
+        bool ok;
+
+    public:
+        ByteReader(const char* bytes, size_t length) : data(bytes), size(length), position(0), ok(true) {}
+
+        template <class T> T number() {
+            T value = T();
+            if (position + sizeof(T) > size) {
+                ok = false;
+                return value;
+            }
+            memcpy(&value, data + position, sizeof(T));
+            position += sizeof(T);
+            return value;
+        }
+
+        string text() {
+            uint16_t length = number<uint16_t>();
+            if (!ok || position + length > size) {
+                ok = false;
+                return "";
+            }
+            string value(data + position, length);
+            position += length;
+            return value;
+        }
+
+        bool good() const { return ok; }
+        bool atEnd() const { return position == size; }
+};
+
+#endif
@@ -0,0 +1,202 @@
+#include "Common.h"
+#include "Instrumentation.h"
+#include "AsyncWriter.h"
+
+/**
+ * Generic function to generate a new ID.
+ * @param filename The file to read existing IDs from.
+ * @param prefix The prefix for the ID ("APUTCP" or "W").
+ * @param width The numeric part width (3 for "001").
+ * @param defaultStart The starting number if no ID is found.
+ * @return A new auto-incremented ID.
+ */
+string generateId(const string& filename, const string& prefix, int width, int defaultStart) {
+    INSTRUMENT_FILE_SCOPE("generateId");
+    syncFile(filename);
+    ifstream file(filename);
+    string lastId = "";
+    string line;
+    while(getline(file, line)) {
+        if(line.empty()) continue;
+        // Assume the ID is the first field (separated by a comma)
+        stringstream ss(line);
+        getline(ss, lastId, ',');
+    }
+    file.close();
+    
+    int num = defaultStart;
+    if(!lastId.empty()){
+        // Extract numeric part from lastId assuming it starts with prefix.
+        string numStr = lastId.substr(prefix.size());
+        num = stoi(numStr) + 1;
+    }
+    
+    stringstream ss;
+    ss << prefix << setfill('0') << setw(width) << num;
+    return ss.str();
+}
+
+/**
+ * Build a match time from calendar fields
+ * @param day The day of the month (1-31)
+ * @param month The month (1-12)
+ * @param year The year (MATCH_TIME_FIRST_YEAR to MATCH_TIME_LAST_YEAR)
+ * @param hour The hour (0-23)
+ * @param minute The minute (0-59)
+ * @return The match time, TIME_INVALID if the year is out of range
+ */
+MatchTime makeMatchTime(int day, int month, int year, int hour, int minute) {
+    // Later years would overflow the 32-bit minutes instead of failing
+    if (year < MATCH_TIME_FIRST_YEAR || year > MATCH_TIME_LAST_YEAR) return TIME_INVALID;
+
+    // Days from civil date (proleptic Gregorian calendar)
+    year -= month <= 2;
+    int era = (year >= 0 ? year : year - 399) / 400;
+    int yearOfEra = year - era * 400;
+    int dayOfYear = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    int dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    int days = era * 146097 + dayOfEra - 719468;
+    return days * 1440 + hour * 60 + minute;
+}
+
+/**
+ * Split a match time into calendar fields
+ * @param time The match time
+ * @param day Output: the day of the month
+ * @param month Output: the month
+ * @param year Output: the year
+ * @param hour Output: the hour
+ * @param minute Output: the minute
+ */
+void splitMatchTime(MatchTime time, int& day, int& month, int& year, int& hour, int& minute) {
+    int days = time / 1440;
+    int minuteOfDay = time % 1440;
+    hour = minuteOfDay / 60;
+    minute = minuteOfDay % 60;
+
+    days += 719468;
+    int era = (days >= 0 ? days : days - 146096) / 146097;
+    int dayOfEra = days - era * 146097;
+    int yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+    int dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+    int monthIndex = (5 * dayOfYear + 2) / 153;
+    day = dayOfYear - (153 * monthIndex + 2) / 5 + 1;
+    month = monthIndex < 10 ? monthIndex + 3 : monthIndex - 9;
+    year = yearOfEra + era * 400 + (month <= 2);
+}
+
+/**
+ * Parse a date and time from the files
+ * Accepts "DD-MM-YYYY HH:MM", "DD-MM-YYYY HH:MM:SS", "DD-MM-YYYY" and "TBD..."
+ * @param text The text to parse
+ * @return The match time, TIME_TBD or TIME_INVALID
+ */
+MatchTime parseMatchTime(const string& text) {
+    size_t first = text.find_first_not_of(" \t\r");
+    if (first == string::npos) return TIME_INVALID;
+    size_t last = text.find_last_not_of(" \t\r");
+    const char* p = text.c_str() + first;
+    size_t length = last - first + 1;
+
+    if (text.compare(first, 3, "TBD") == 0) return TIME_TBD;
+    if (length != 10 && length != 16 && length != 19) return TIME_INVALID;
+
+    // Read a fixed-width number, -1 if a character is not a digit
+    auto number = [p](int offset, int width) {
+        int value = 0;
+        for (int i = offset; i < offset + width; i++) {
+            if (p[i] < '0' || p[i] > '9') return -1;
+            value = value * 10 + (p[i] - '0');
+        }
+        return value;
+    };
+
+    if (p[2] != '-' || p[5] != '-') return TIME_INVALID;
+    int day = number(0, 2), month = number(3, 2), year = number(6, 4);
+    int hour = 0, minute = 0;
+    if (length >= 16) {
+        if (p[10] != ' ' || p[13] != ':') return TIME_INVALID;
+        hour = number(11, 2);
+        minute = number(14, 2);
+        if (length == 19 && (p[16] != ':' || number(17, 2) < 0)) return TIME_INVALID;
+    }
+
+    static const int daysInMonth[] = {31, 29, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    if (month < 1 || month > 12 || day < 1 || day > daysInMonth[month - 1] ||
+        year < MATCH_TIME_FIRST_YEAR || year > MATCH_TIME_LAST_YEAR || hour < 0 || hour > 23 || minute < 0 || minute > 59) {
+        return TIME_INVALID;
+    }
+    bool leapYear = (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+    if (month == 2 && day == 29 && !leapYear) return TIME_INVALID;
+    return makeMatchTime(day, month, year, hour, minute);
+}
+
+/**
+ * Format a match time for the files and the console
+ * @param time The match time
+ * @return The time as "DD-MM-YYYY HH:MM", or "TBD"
+ */
+string formatMatchTime(MatchTime time) {
+    if (time == TIME_TBD) return "TBD";
+    if (time < 0) return "Invalid";
+    int day, month, year, hour, minute;
+    splitMatchTime(time, day, month, year, hour, minute);
+    char buffer[20];
+    snprintf(buffer, sizeof(buffer), "%02d-%02d-%04d %02d:%02d", day, month, year, hour, minute);
+    return string(buffer);
+}
+
+/**
+ * Get the current local time as a match time
+ * @return The current match time
+ */
+MatchTime currentMatchTime() {
+    time_t now = time(0);
+    struct tm* timeinfo = localtime(&now);
+    return makeMatchTime(timeinfo -> tm_mday, timeinfo -> tm_mon + 1, timeinfo -> tm_year + 1900,
+                         timeinfo -> tm_hour, timeinfo -> tm_min);
+}
+
+/**
+ * Get midnight of the tournament's first day
+ * Read once from TOURNAMENT_START (DD-MM-YYYY); a missing or invalid date falls back to DEFAULT_TOURNAMENT_START.
+ * @return The match time of the first day at 00:00
+ */
+MatchTime tournamentStart() {
+    static const MatchTime start = []() {
+        const char* date = getenv("TOURNAMENT_START");
+        MatchTime parsed = date && *date ? parseMatchTime(date) : TIME_INVALID;
+        if (parsed < 0) parsed = parseMatchTime(DEFAULT_TOURNAMENT_START);
+        return parsed - parsed % 1440;
+    }();
+    return start;
+}
+
+/**
+ * Format a number with a fixed count of decimals
+ * The number is formatted on its own stream, so console output keeps its format flags.
+ * @param value The number
+ * @param decimals The count of decimals
+ * @return The text e.g. 1512.4
+ */
+string formatDecimal(double value, int decimals) {
+    ostringstream text;
+    text << fixed << setprecision(decimals) << value;
+    return text.str();
+}
+
+/**
+ * Parse a whole-string integer field
+ * @param text the field
+ * @param value Output: the number
+ * @return True if the field is an integer, else False
+ */
+bool parseInt(const string& text, int& value) {
+    size_t used = 0;
+    try {
+        value = stoi(text, &used);
+    } catch (const exception&) {
+        return false;
+    }
+    return used == text.size();
+}
@@ -0,0 +1,66 @@
+#ifndef CORE_COMMON_H
+#define CORE_COMMON_H
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <ctime>
+#include <map>
+#include <iomanip>
+#include <string>
+#include <cstring>
+#include <stack>
+#include <limits>
+#include <algorithm>
+#include <stdexcept>
+#include <regex>
+#include <queue>
+#include <cmath>
+#include <vector>
+#include <cstdint>
+#include <unordered_map>
+#include <unordered_set>
+#include <sys/stat.h>
+#include <chrono>
+#include <random>
+#include <set>
+#include <thread>
+
+using namespace std;
+
+// Generate the next ID after the last one in a file (e.g. W001 -> W002)
+string generateId(const string& filename, const string& prefix, int width, int defaultStart = 1);
+
+/**
+ * Match time as minutes since 01-01-1970 00:00 on the tournament's calendar (no time zone).
+ * Times are parsed and formatted only when the text files are read or written;
+ * everywhere else they compare and sort as plain integers.
+ */
+typedef int32_t MatchTime;
+const MatchTime TIME_TBD = -1;      // Not scheduled yet ("TBD" in the files)
+const MatchTime TIME_INVALID = -2;  // Text that is not a valid date and time
+
+// Years a MatchTime can hold (32-bit minutes since 1970 run out in the year 6053)
+const int MATCH_TIME_FIRST_YEAR = 1970;
+const int MATCH_TIME_LAST_YEAR = 6000;
+
+// Default first day of the tournament, DD-MM-YYYY
+const char* const DEFAULT_TOURNAMENT_START = "28-04-2025";
+
+// Match time conversions (see Common.cpp)
+MatchTime makeMatchTime(int day, int month, int year, int hour = 0, int minute = 0);
+void splitMatchTime(MatchTime time, int& day, int& month, int& year, int& hour, int& minute);
+MatchTime parseMatchTime(const string& text);
+string formatMatchTime(MatchTime time);
+MatchTime currentMatchTime();
+
+// Midnight of the tournament's first day (TOURNAMENT_START=DD-MM-YYYY, default DEFAULT_TOURNAMENT_START)
+MatchTime tournamentStart();
+
+// Format a number with a fixed count of decimals, leaving the format flags of cout untouched
+string formatDecimal(double value, int decimals);
+
+// Parse a whole-string integer, rejecting trailing text such as "1abc"
+bool parseInt(const string& text, int& value);
+
+#endif
@@ -0,0 +1,643 @@
+#include "EventLog.h"
+#include "ByteBuffer.h"
+#include "Instrumentation.h"
+#include "Logger.h"
+#include <unistd.h>
+
+static const char LOG_MAGIC[9] = "TEVLOG01";
+static const char SNAPSHOT_MAGIC[9] = "TEVSNP01";
+static const size_t MAGIC_SIZE = 8;
+static const size_t RECORD_HEADER_SIZE = 24;         // Length, type, reserved, sequence, timestamp
+static const uint32_t MAX_RECORD_SIZE = 1 << 20;     // Larger lengths can only come from a damaged file
+
+/**
+ * FNV-1a checksum
+ * @param data the bytes
+ * @param size the number of bytes
+ */
+static uint32_t checksum(const char* data, size_t size) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= (unsigned char)data[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+/** ---- Event payloads ---- */
+
+// Writes the payload of each event type
+struct PayloadWriter {
+    ByteWriter& out;
+
+    void operator()(const MatchScheduledEvent& e) const {
+        out.text(e.matchID);
+        out.text(e.stageID);
+        out.text(e.roundID);
+        out.text(e.p1ID);
+        out.text(e.p2ID);
+        out.number<int32_t>(e.scheduledTime);
+        out.text(e.status);
+        out.text(e.courtID);
+    }
+    void operator()(const PlayerAdvancedEvent& e) const {
+        out.text(e.playerID);
+        out.text(e.fromStage);
+        out.text(e.toStage);
+    }
+    void operator()(const PlayerWithdrawnEvent& e) const {
+        out.text(e.withdrawalID);
+        out.text(e.playerID);
+        out.text(e.name);
+        out.text(e.reason);
+    }
+    void operator()(const PlayerSubstitutedEvent& e) const {
+        out.text(e.matchID);
+        out.text(e.withdrawnID);
+        out.text(e.substituteID);
+    }
+    void operator()(const TicketSoldEvent& e) const {
+        out.text(e.ticketID);
+        out.text(e.name);
+        out.text(e.ticketType);
+        out.text(e.courtID);
+        out.text(e.matchID);
+        out.number<int32_t>(e.seats);
+        out.text(e.status);
+        out.text(e.seatLabels);
+    }
+    void operator()(const GatePassedEvent& e) const {
+        out.text(e.ticketID);
+        out.text(e.courtID);
+        out.number<uint8_t>(e.isEntry ? 1 : 0);
+        out.number<int32_t>(e.seats);
+        out.number<uint16_t>(e.gateSeats.size());
+        for (int seats : e.gateSeats) out.number<int32_t>(seats);
+    }
+    void operator()(const ResultRecordedEvent& e) const {
+        out.text(e.matchID);
+        out.text(e.stageID);
+        out.text(e.p1ID);
+        out.text(e.p2ID);
+        out.number<int32_t>(e.score1);
+        out.number<int32_t>(e.score2);
+        out.number<int32_t>(e.matchTime);
+        out.text(e.duration);
+    }
+};
+
+// Read the fields of each event type, in the order PayloadWriter writes them
+static void readFields(ByteReader& in, MatchScheduledEvent& e) {
+    e.matchID = in.text();
+    e.stageID = in.text();
+    e.roundID = in.text();
+    e.p1ID = in.text();
+    e.p2ID = in.text();
+    e.scheduledTime = in.number<int32_t>();
+    e.status = in.text();
+    e.courtID = in.text();
+}
+static void readFields(ByteReader& in, PlayerAdvancedEvent& e) {
+    e.playerID = in.text();
+    e.fromStage = in.text();
+    e.toStage = in.text();
+}
+static void readFields(ByteReader& in, PlayerWithdrawnEvent& e) {
+    e.withdrawalID = in.text();
+    e.playerID = in.text();
+    e.name = in.text();
+    e.reason = in.text();
+}
+static void readFields(ByteReader& in, PlayerSubstitutedEvent& e) {
+    e.matchID = in.text();
+    e.withdrawnID = in.text();
+    e.substituteID = in.text();
+}
+static void readFields(ByteReader& in, TicketSoldEvent& e) {
+    e.ticketID = in.text();
+    e.name = in.text();
+    e.ticketType = in.text();
+    e.courtID = in.text();
+    e.matchID = in.text();
+    e.seats = in.number<int32_t>();
+    e.status = in.text();
+    e.seatLabels = in.text();
+}
+static void readFields(ByteReader& in, GatePassedEvent& e) {
+    e.ticketID = in.text();
+    e.courtID = in.text();
+    e.isEntry = in.number<uint8_t>() != 0;
+    e.seats = in.number<int32_t>();
+    uint16_t gates = in.number<uint16_t>();
+    e.gateSeats.clear();
+    for (int i = 0; i < gates && in.good(); i++) e.gateSeats.push_back(in.number<int32_t>());
+}
+static void readFields(ByteReader& in, ResultRecordedEvent& e) {
+    e.matchID = in.text();
+    e.stageID = in.text();
+    e.p1ID = in.text();
+    e.p2ID = in.text();
+    e.score1 = in.number<int32_t>();
+    e.score2 = in.number<int32_t>();
+    e.matchTime = in.number<int32_t>();
+    e.duration = in.text();
+}
+
+template <class T> static void readAs(ByteReader& in, EventPayload& payload) {
+    T event;
+    readFields(in, event);
+    payload = move(event);
+}
+
+/**
+ * Read the payload of a record
+ * @param type the record type
+ * @param in the payload bytes
+ * @param payload Output: the event
+ * @return True if the payload is a complete event of the type, else False
+ */
+static bool readPayload(uint8_t type, ByteReader& in, EventPayload& payload) {
+    switch (type) {
+        case 1: readAs<MatchScheduledEvent>(in, payload); break;
+        case 2: readAs<PlayerAdvancedEvent>(in, payload); break;
+        case 3: readAs<PlayerWithdrawnEvent>(in, payload); break;
+        case 4: readAs<PlayerSubstitutedEvent>(in, payload); break;
+        case 5: readAs<TicketSoldEvent>(in, payload); break;
+        case 6: readAs<GatePassedEvent>(in, payload); break;
+        case 7: readAs<ResultRecordedEvent>(in, payload); break;
+        default: return false;
+    }
+    return in.good() && in.atEnd();
+}
+
+/**
+ * Append one record to a buffer
+ * @param out the buffer
+ * @param event the event
+ */
+static void writeRecord(string& out, const TournamentEvent& event) {
+    ByteWriter writer(out);
+    size_t start = out.size();
+    writer.number<uint32_t>(0);
+    writer.number<uint8_t>(event.payload.index() + 1);
+    writer.number<uint8_t>(0);
+    writer.number<uint16_t>(0);
+    writer.number<uint64_t>(event.sequence);
+    writer.number<int64_t>(event.timestamp);
+    visit(PayloadWriter{writer}, event.payload);
+    writer.patch<uint32_t>(start, out.size() - start - RECORD_HEADER_SIZE);
+    writer.number<uint32_t>(checksum(out.data() + start + 4, out.size() - start - 4));
+}
+
+/** ---- Tournament state ---- */
+
+void TournamentState::clear() {
+    matches.clear();
+    matchIndex.clear();
+    playerStages.clear();
+    withdrawals.clear();
+    substitutions = 0;
+    tickets.clear();
+    ticketIndex.clear();
+    seatsTaken.clear();
+    results.clear();
+    lastSequence = 0;
+    lastTimestamp = 0;
+    eventCount = 0;
+}
+
+// Applies each event type to a state
+struct StateUpdater {
+    TournamentState& state;
+    int64_t timestamp;
+
+    void operator()(const MatchScheduledEvent& e) const {
+        auto inserted = state.matchIndex.emplace(e.matchID, state.matches.size());
+        if (inserted.second) {
+            state.matches.push_back(e);
+        } else {
+            state.matches[inserted.first -> second] = e;
+        }
+    }
+    void operator()(const PlayerAdvancedEvent& e) const {
+        state.playerStages[e.playerID] = e.toStage;
+    }
+    void operator()(const PlayerWithdrawnEvent& e) const {
+        state.withdrawals.push_back(WithdrawalEntry{e, timestamp});
+    }
+    void operator()(const PlayerSubstitutedEvent& e) const {
+        state.substitutions++;
+        auto it = state.matchIndex.find(e.matchID);
+        if (it == state.matchIndex.end()) return;
+        MatchScheduledEvent& match = state.matches[it -> second];
+        if (match.p1ID == e.withdrawnID) match.p1ID = e.substituteID;
+        if (match.p2ID == e.withdrawnID) match.p2ID = e.substituteID;
+    }
+    void operator()(const TicketSoldEvent& e) const {
+        state.ticketIndex[e.ticketID] = state.tickets.size();
+        state.tickets.push_back(TicketEntry{e, timestamp, {}});
+        if (e.status == "Purchased") state.seatsTaken[e.courtID] += e.seats;
+    }
+    void operator()(const GatePassedEvent& e) const {
+        state.seatsTaken[e.courtID] += e.isEntry ? e.seats : -e.seats;
+        auto it = state.ticketIndex.find(e.ticketID);
+        if (it == state.ticketIndex.end()) return;
+        TicketEntry& ticket = state.tickets[it -> second];
+        if (e.isEntry) {
+            ticket.gateSeats = e.gateSeats;
+        } else {
+            ticket.gateSeats.clear();
+        }
+    }
+    void operator()(const ResultRecordedEvent& e) const {
+        state.results.push_back(e);
+    }
+};
+
+void TournamentState::apply(const TournamentEvent& event) {
+    visit(StateUpdater{*this, event.timestamp}, event.payload);
+    lastSequence = event.sequence;
+    lastTimestamp = event.timestamp;
+    eventCount++;
+}
+
+/**
+ * Format seconds since 1970 as local time
+ * @param timestamp the seconds
+ */
+static string formatTimestamp(int64_t timestamp) {
+    if (timestamp == 0) return "-";
+    time_t seconds = timestamp;
+    char buffer[20];
+    strftime(buffer, sizeof(buffer), "%Y-%m-%d %H:%M:%S", localtime(&seconds));
+    return buffer;
+}
+
+void TournamentState::display() const {
+    cout << "\n--- Tournament State after event " << lastSequence << " (" << formatTimestamp(lastTimestamp) << ") ---\n";
+
+    map<string, int> byStatus;
+    for (const MatchScheduledEvent& match : matches) byStatus[match.status]++;
+    cout << "Matches:          " << matches.size();
+    for (const auto& status : byStatus) cout << "  " << status.first << " " << status.second;
+    cout << "\n";
+
+    map<string, int> byStage;
+    for (const auto& player : playerStages) byStage[player.second]++;
+    cout << "Player stages:    " << playerStages.size();
+    for (const auto& stage : byStage) cout << "  " << stage.first << " " << stage.second;
+    cout << "\n";
+
+    cout << "Withdrawals:      " << withdrawals.size() << "  (substitutions " << substitutions << ")\n";
+
+    int purchased = 0, rejected = 0, inside = 0;
+    for (const TicketEntry& ticket : tickets) {
+        if (ticket.sale.status == "Purchased") {
+            purchased++;
+        } else {
+            rejected++;
+        }
+        if (!ticket.gateSeats.empty()) inside++;
+    }
+    cout << "Tickets:          " << purchased << " purchased, " << rejected << " rejected, " << inside << " inside\n";
+    for (const auto& court : seatsTaken) cout << "  Court " << court.first << ": " << court.second << " seats taken\n";
+
+    cout << "Results recorded: " << results.size() << "\n";
+    for (size_t i = results.size() > 5 ? results.size() - 5 : 0; i < results.size(); i++) {
+        const ResultRecordedEvent& result = results[i];
+        cout << "  " << result.matchID << " " << result.p1ID << " vs " << result.p2ID << " "
+             << result.score1 << "-" << result.score2 << " at " << formatMatchTime(result.matchTime) << "\n";
+    }
+}
+
+void TournamentState::serialize(string& out) const {
+    ByteWriter writer(out);
+    PayloadWriter payload{writer};
+    writer.number<uint64_t>(lastSequence);
+    writer.number<int64_t>(lastTimestamp);
+    writer.number<uint64_t>(eventCount);
+    writer.number<uint32_t>(matches.size());
+    for (const MatchScheduledEvent& match : matches) payload(match);
+    writer.number<uint32_t>(playerStages.size());
+    for (const auto& player : playerStages) {
+        writer.text(player.first);
+        writer.text(player.second);
+    }
+    writer.number<uint32_t>(withdrawals.size());
+    for (const WithdrawalEntry& entry : withdrawals) {
+        payload(entry.withdrawal);
+        writer.number<int64_t>(entry.withdrawnAt);
+    }
+    writer.number<int32_t>(substitutions);
+    writer.number<uint32_t>(tickets.size());
+    for (const TicketEntry& ticket : tickets) {
+        payload(ticket.sale);
+        writer.number<int64_t>(ticket.soldAt);
+        writer.number<uint16_t>(ticket.gateSeats.size());
+        for (int seats : ticket.gateSeats) writer.number<int32_t>(seats);
+    }
+    writer.number<uint32_t>(seatsTaken.size());
+    for (const auto& court : seatsTaken) {
+        writer.text(court.first);
+        writer.number<int32_t>(court.second);
+    }
+    writer.number<uint32_t>(results.size());
+    for (const ResultRecordedEvent& result : results) payload(result);
+}
+
+bool TournamentState::deserialize(const string& in) {
+    clear();
+    ByteReader reader(in.data(), in.size());
+    lastSequence = reader.number<uint64_t>();
+    lastTimestamp = reader.number<int64_t>();
+    eventCount = reader.number<uint64_t>();
+
+    uint32_t count = reader.number<uint32_t>();
+    for (uint32_t i = 0; i < count && reader.good(); i++) {
+        MatchScheduledEvent match;
+        readFields(reader, match);
+        matchIndex[match.matchID] = matches.size();
+        matches.push_back(move(match));
+    }
+    count = reader.number<uint32_t>();
+    for (uint32_t i = 0; i < count && reader.good(); i++) {
+        string playerID = reader.text();
+        playerStages[playerID] = reader.text();
+    }
+    count = reader.number<uint32_t>();
+    for (uint32_t i = 0; i < count && reader.good(); i++) {
+        WithdrawalEntry entry;
+        readFields(reader, entry.withdrawal);
+        entry.withdrawnAt = reader.number<int64_t>();
+        withdrawals.push_back(move(entry));
+    }
+    substitutions = reader.number<int32_t>();
+    count = reader.number<uint32_t>();
+    for (uint32_t i = 0; i < count && reader.good(); i++) {
+        TicketEntry ticket;
+        readFields(reader, ticket.sale);
+        ticket.soldAt = reader.number<int64_t>();
+        uint16_t gates = reader.number<uint16_t>();
+        for (int g = 0; g < gates && reader.good(); g++) ticket.gateSeats.push_back(reader.number<int32_t>());
+        ticketIndex[ticket.sale.ticketID] = tickets.size();
+        tickets.push_back(move(ticket));
+    }
+    count = reader.number<uint32_t>();
+    for (uint32_t i = 0; i < count && reader.good(); i++) {
+        string courtID = reader.text();
+        seatsTaken[courtID] = reader.number<int32_t>();
+    }
+    count = reader.number<uint32_t>();
+    for (uint32_t i = 0; i < count && reader.good(); i++) {
+        ResultRecordedEvent result;
+        readFields(reader, result);
+        results.push_back(move(result));
+    }
+
+    if (!reader.good() || !reader.atEnd()) {
+        clear();
+        return false;
+    }
+    return true;
+}
+
+/** ---- Event log ---- */
+
+EventLog::EventLog(const string& filename, int snapshotEvery)
+    : logFilename(filename), snapshotFilename(filename + ".snapshot"), enabled(filename != "off"),
+      opened(false), snapshotInterval(snapshotEvery), logEnd(0), eventsSinceSnapshot(0) {}
+
+EventLog& EventLog::instance() {
+    static EventLog log([]() {
+        const char* filename = getenv("TOURNAMENT_EVENT_LOG");
+        return string(filename && *filename ? filename : "Events.log");
+    }(), []() {
+        const char* interval = getenv("TOURNAMENT_SNAPSHOT_EVERY");
+        return interval ? atoi(interval) : DEFAULT_SNAPSHOT_INTERVAL;
+    }());
+    return log;
+}
+
+long long EventLog::replay(const string& filename, uint64_t fromOffset, int64_t asOf,
+                           TournamentState& state, uint64_t& validEnd) {
+    INSTRUMENT_FILE_SCOPE("EventLog::replay");
+    validEnd = 0;
+    ifstream file(filename, ios::binary | ios::ate);
+    if (!file) return -1;
+    uint64_t fileSize = file.tellg();
+    char magic[MAGIC_SIZE];
+    file.seekg(0);
+    if (fileSize < MAGIC_SIZE || !file.read(magic, MAGIC_SIZE) || memcmp(magic, LOG_MAGIC, MAGIC_SIZE) != 0) return -1;
+
+    // The rest of the log is read in one go and decoded in memory
+    uint64_t start = max<uint64_t>(fromOffset, MAGIC_SIZE);
+    validEnd = start;
+    if (start >= fileSize) return 0;
+    string bytes(fileSize - start, '\0');
+    file.seekg(start);
+    if (!file.read(&bytes[0], bytes.size())) return 0;
+
+    long long applied = 0;
+    size_t position = 0;
+    TournamentEvent event;
+    while (bytes.size() - position >= RECORD_HEADER_SIZE + 4) {
+        ByteReader header(bytes.data() + position, RECORD_HEADER_SIZE);
+        uint32_t length = header.number<uint32_t>();
+        uint8_t type = header.number<uint8_t>();
+        header.number<uint8_t>();
+        header.number<uint16_t>();
+        event.sequence = header.number<uint64_t>();
+        event.timestamp = header.number<int64_t>();
+        if (length > MAX_RECORD_SIZE || bytes.size() - position < RECORD_HEADER_SIZE + length + 4) break;
+
+        uint32_t stored;
+        memcpy(&stored, bytes.data() + position + RECORD_HEADER_SIZE + length, 4);
+        if (stored != checksum(bytes.data() + position + 4, RECORD_HEADER_SIZE - 4 + length)) break;
+        ByteReader payload(bytes.data() + position + RECORD_HEADER_SIZE, length);
+        if (!readPayload(type, payload, event.payload)) break;
+
+        // Records of a later time stay in the log but are not applied
+        if (event.timestamp > asOf) {
+            validEnd = start + position;
+            return applied;
+        }
+        state.apply(event);
+        applied++;
+        position += RECORD_HEADER_SIZE + length + 4;
+    }
+    validEnd = start + position;
+    return applied;
+}
+
+bool EventLog::loadSnapshot(TournamentState& state, uint64_t& offset) const {
+    ifstream file(snapshotFilename, ios::binary);
+    if (!file) return false;
+    string bytes((istreambuf_iterator<char>(file)), istreambuf_iterator<char>());
+    if (bytes.size() < MAGIC_SIZE + 16 || memcmp(bytes.data(), SNAPSHOT_MAGIC, MAGIC_SIZE) != 0) return false;
+
+    ByteReader header(bytes.data() + MAGIC_SIZE, 12);
+    offset = header.number<uint64_t>();
+    uint32_t length = header.number<uint32_t>();
+    size_t payloadStart = MAGIC_SIZE + 12;
+    if (bytes.size() != payloadStart + length + 4) return false;
+    uint32_t stored;
+    memcpy(&stored, bytes.data() + payloadStart + length, 4);
+    if (stored != checksum(bytes.data(), payloadStart + length)) return false;
+    return state.deserialize(bytes.substr(payloadStart, length));
+}
+
+void EventLog::open() {
+    INSTRUMENT_FILE_SCOPE("EventLog::open");
+    opened = true;
+    current.clear();
+
+    struct stat info;
+    if (stat(logFilename.c_str(), &info) != 0 || info.st_size == 0) {
+        // A new log; a snapshot left from an older log would not match it
+        remove(snapshotFilename.c_str());
+        ofstream create(logFilename, ios::binary);
+        create.write(LOG_MAGIC, MAGIC_SIZE);
+        if (!create) {
+            LOG_EVENT(LOG_ERROR, "eventLog.openFailed", "Error: Could not create " << logFilename << ". Events are not logged.\n",
+                      {"file", logFilename});
+            enabled = false;
+            return;
+        }
+        logEnd = MAGIC_SIZE;
+    } else {
+        uint64_t offset = 0;
+        bool fromSnapshot = loadSnapshot(current, offset) && offset <= (uint64_t)info.st_size;
+        if (!fromSnapshot) current.clear();
+        long long applied = replay(logFilename, fromSnapshot ? offset : 0, INT64_MAX, current, logEnd);
+        if (applied < 0) {
+            // Never append to a file that is not an event log
+            LOG_EVENT(LOG_ERROR, "eventLog.invalid", "Error: " << logFilename << " is not an event log. Events are not logged.\n",
+                      {"file", logFilename});
+            enabled = false;
+            return;
+        }
+        eventsSinceSnapshot = applied;
+        if (logEnd < (uint64_t)info.st_size) {
+            LOG_EVENT(LOG_WARN, "eventLog.truncated",
+                      "Event log " << logFilename << " ends with an incomplete record; " << (info.st_size - logEnd) << " bytes were dropped.\n",
+                      {"file", logFilename}, {"bytes", to_string(info.st_size - logEnd)});
+            if (truncate(logFilename.c_str(), logEnd) != 0) {
+                enabled = false;
+                return;
+            }
+        }
+    }
+    out.open(logFilename, ios::binary | ios::app);
+    if (!out) enabled = false;
+}
+
+void EventLog::append(const vector<EventPayload>& payloads) {
+    INSTRUMENT_SCOPE("EventLog::append");
+    lock_guard<mutex> lock(logMutex);
+    if (!enabled || payloads.empty()) return;
+    if (!opened) {
+        open();
+        if (!enabled) return;
+    }
+
+    TournamentEvent event;
+    event.timestamp = time(0);
+    string buffer;
+    size_t first = 0;
+    for (const EventPayload& payload : payloads) {
+        event.sequence = current.lastSequence + 1 + first++;
+        event.payload = payload;
+        writeRecord(buffer, event);
+    }
+    // One write and flush per batch, so a crash loses at most the batch being written
+    out.write(buffer.data(), buffer.size());
+    out.flush();
+    if (!out) {
+        LOG_EVENT(LOG_ERROR, "eventLog.writeFailed", "Error: Could not write to " << logFilename << ".\n", {"file", logFilename});
+        out.clear();
+        return;
+    }
+    logEnd += buffer.size();
+    uint64_t sequence = current.lastSequence;
+    for (const EventPayload& payload : payloads) {
+        event.sequence = ++sequence;
+        event.payload = payload;
+        current.apply(event);
+    }
+    INSTRUMENT_COUNT("events logged", payloads.size());
+
+    eventsSinceSnapshot += payloads.size();
+    if (snapshotInterval > 0 && eventsSinceSnapshot >= snapshotInterval) saveSnapshot();
+}
+
+bool EventLog::saveSnapshot() {
+    INSTRUMENT_FILE_SCOPE("EventLog::saveSnapshot");
+    string bytes(SNAPSHOT_MAGIC, MAGIC_SIZE);
+    ByteWriter writer(bytes);
+    writer.number<uint64_t>(logEnd);
+    writer.number<uint32_t>(0);
+    size_t payloadStart = bytes.size();
+    current.serialize(bytes);
+    writer.patch<uint32_t>(MAGIC_SIZE + 8, bytes.size() - payloadStart);
+    writer.number<uint32_t>(checksum(bytes.data(), bytes.size()));
+
+    // Written aside and renamed, so a crash never leaves a half-written snapshot
+    string tempFilename = snapshotFilename + ".tmp";
+    ofstream file(tempFilename, ios::binary | ios::trunc);
+    file.write(bytes.data(), bytes.size());
+    file.close();
+    if (!file || rename(tempFilename.c_str(), snapshotFilename.c_str()) != 0) {
+        LOG_EVENT(LOG_ERROR, "eventLog.snapshotFailed", "Error: Could not write " << snapshotFilename << ".\n", {"file", snapshotFilename});
+        return false;
+    }
+    eventsSinceSnapshot = 0;
+    return true;
+}
+
+bool EventLog::writeSnapshot() {
+    lock_guard<mutex> lock(logMutex);
+    if (!enabled) return false;
+    if (!opened) open();
+    return enabled && saveSnapshot();
+}
+
+bool EventLog::isRecorded(const MatchScheduledEvent& match) {
+    lock_guard<mutex> lock(logMutex);
+    if (!enabled) return true;
+    if (!opened) open();
+    const MatchScheduledEvent* recorded = current.findMatch(match.matchID);
+    return recorded != nullptr && recorded -> stageID == match.stageID && recorded -> roundID == match.roundID
+        && recorded -> p1ID == match.p1ID && recorded -> p2ID == match.p2ID && recorded -> scheduledTime == match.scheduledTime
+        && recorded -> status == match.status && recorded -> courtID == match.courtID;
+}
+
+string EventLog::recordedStage(const string& playerID) {
+    lock_guard<mutex> lock(logMutex);
+    if (!opened && enabled) open();
+    auto it = current.playerStages.find(playerID);
+    return it == current.playerStages.end() ? "" : it -> second;
+}
+
+TournamentState EventLog::state() {
+    lock_guard<mutex> lock(logMutex);
+    if (!opened && enabled) open();
+    return current;
+}
+
+TournamentState EventLog::stateAsOf(int64_t timestamp) {
+    INSTRUMENT_SCOPE("EventLog::stateAsOf");
+    lock_guard<mutex> lock(logMutex);
+    if (!opened && enabled) open();
+    TournamentState state;
+    if (!enabled) return state;
+    if (timestamp >= current.lastTimestamp) return current;
+
+    uint64_t offset = 0;
+    if (!loadSnapshot(state, offset) || state.lastTimestamp > timestamp || offset > logEnd) {
+        state.clear();
+        offset = 0;
+    }
+    uint64_t validEnd;
+    replay(logFilename, offset, timestamp, state, validEnd);
+    return state;
+}
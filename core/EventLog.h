@@ -0,0 +1,252 @@
+#ifndef CORE_EVENT_LOG_H
+#define CORE_EVENT_LOG_H
+
+#include "Common.h"
+#include <mutex>
+#include <variant>
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------
+ * --------------------------------------------------- Event Log --------------------------------------------------
+ * ----------------------------------------------------------------------------------------------------------------
+ * Every change to the scheduled matches, player stages, withdrawals, ticket sales, gate passes and match results
+ * is appended as one typed binary record to a single log file (Events.log). Replaying the log rebuilds the state
+ * of the scheduler, the ticketing session and the match history; a snapshot taken every thousand events (by default)
+ * lets a replay start part way through, and the state as of any earlier time can be rebuilt for audits.
+ *
+ * Log file: the magic "TEVLOG01", then records of
+ *   uint32 payload length, uint8 type, 3 reserved bytes, uint64 sequence, int64 timestamp (seconds since 1970),
+ *   payload, uint32 FNV-1a checksum of everything from the type to the end of the payload.
+ * Strings are a uint16 length and the bytes; numbers are in host byte order. A torn record at the end
+ * (e.g. after a crash) is cut off when the log is opened.
+ *
+ * Environment: TOURNAMENT_EVENT_LOG=<log path> ("off" disables the log) and
+ * TOURNAMENT_SNAPSHOT_EVERY=<events between snapshots>.
+ */
+
+const int DEFAULT_SNAPSHOT_INTERVAL = 1000;   // Events between two snapshots
+
+// A match was scheduled or one of its fields changed (the whole row is recorded)
+struct MatchScheduledEvent {
+    string matchID;
+    string stageID;
+    string roundID;
+    string p1ID;
+    string p2ID;
+    MatchTime scheduledTime;
+    string status;
+    string courtID;
+};
+
+// A player's stage changed (fromStage is empty for the first record of a player)
+struct PlayerAdvancedEvent {
+    string playerID;
+    string fromStage;
+    string toStage;
+};
+
+// A player withdrew from the tournament
+struct PlayerWithdrawnEvent {
+    string withdrawalID;
+    string playerID;
+    string name;
+    string reason;
+};
+
+// A withdrawn player was replaced in one match
+struct PlayerSubstitutedEvent {
+    string matchID;
+    string withdrawnID;
+    string substituteID;
+};
+
+// A ticket request was purchased or rejected
+struct TicketSoldEvent {
+    string ticketID;
+    string name;
+    string ticketType;
+    string courtID;
+    string matchID;
+    int seats;
+    string status;          // Purchased or Rejected
+    string seatLabels;
+};
+
+// A ticket holder entered or left a court
+struct GatePassedEvent {
+    string ticketID;
+    string courtID;
+    bool isEntry;
+    int seats;              // Seats taken from (entry) or given back to (exit) the court's capacity
+    vector<int> gateSeats;  // Seats per gate on entry
+};
+
+// A match result was recorded
+struct ResultRecordedEvent {
+    string matchID;
+    string stageID;
+    string p1ID;
+    string p2ID;
+    int score1;
+    int score2;
+    MatchTime matchTime;
+    string duration;
+};
+
+// Record type on disk = variant index + 1, so new types go at the end
+typedef variant<MatchScheduledEvent, PlayerAdvancedEvent, PlayerWithdrawnEvent, PlayerSubstitutedEvent,
+                TicketSoldEvent, GatePassedEvent, ResultRecordedEvent> EventPayload;
+
+// One record of the log
+struct TournamentEvent {
+    uint64_t sequence;
+    int64_t timestamp;      // Seconds since 01-01-1970 (UTC)
+    EventPayload payload;
+};
+
+// A ticket in the replayed state
+struct TicketEntry {
+    TicketSoldEvent sale;
+    int64_t soldAt;
+    vector<int> gateSeats;  // Seats per gate while inside, empty when outside
+};
+
+// A withdrawal in the replayed state
+struct WithdrawalEntry {
+    PlayerWithdrawnEvent withdrawal;
+    int64_t withdrawnAt;
+};
+
+/**
+ * Tournament state rebuilt from the log
+ */
+class TournamentState {
+    public:
+        vector<MatchScheduledEvent> matches;        // In the order they were first scheduled
+        unordered_map<string, int> matchIndex;
+        map<string, string> playerStages;           // Players whose stage was recorded
+        vector<WithdrawalEntry> withdrawals;
+        int substitutions;
+        vector<TicketEntry> tickets;                // In sale order, rejected requests included
+        unordered_map<string, int> ticketIndex;
+        map<string, int> seatsTaken;                // Net capacity taken per court by sales and gate passes
+        vector<ResultRecordedEvent> results;        // In the order they were recorded
+        uint64_t lastSequence;
+        int64_t lastTimestamp;
+        uint64_t eventCount;
+
+        TournamentState() { clear(); }
+
+        void clear();
+
+        // Apply one event
+        void apply(const TournamentEvent& event);
+
+        const MatchScheduledEvent* findMatch(const string& matchID) const {
+            auto it = matchIndex.find(matchID);
+            return it == matchIndex.end() ? nullptr : &matches[it -> second];
+        }
+
+        // Print the totals of the state
+        void display() const;
+
+        // Binary form used by the snapshots
+        void serialize(string& out) const;
+        bool deserialize(const string& in);
+};
+
+/**
+ * The append-only event log and its live state.
+ * Appends are serialised by a mutex, so any thread may record events.
+ */
+class EventLog {
+    private:
+        string logFilename;
+        string snapshotFilename;
+        bool enabled;
+        bool opened;
+        int snapshotInterval;
+        mutex logMutex;
+        ofstream out;
+        TournamentState current;        // State after the last record
+        uint64_t logEnd;                // Offset after the last valid record
+        int eventsSinceSnapshot;
+
+        // Open the log, loading the snapshot and replaying the records after it (lock held)
+        void open();
+
+        // Write the live state as the snapshot (lock held)
+        bool saveSnapshot();
+
+        /**
+         * Load the snapshot file
+         * @param state the snapshot's state
+         * @param offset the log offset the snapshot was taken at
+         * @return True if a valid snapshot was loaded, else False
+         */
+        bool loadSnapshot(TournamentState& state, uint64_t& offset) const;
+
+    public:
+        /**
+         * @param filename the log file, "off" for a disabled log
+         * @param snapshotEvery the events between two snapshots, 0 for no automatic snapshots
+         */
+        EventLog(const string& filename, int snapshotEvery = DEFAULT_SNAPSHOT_INTERVAL);
+        EventLog(const EventLog&) = delete;
+        EventLog& operator=(const EventLog&) = delete;
+
+        // The log of the program (TOURNAMENT_EVENT_LOG, default Events.log in the current directory)
+        static EventLog& instance();
+
+        bool isEnabled() const { return enabled; }
+        void setEnabled(bool isEnabled) { enabled = isEnabled; }
+        const string& getFilename() const { return logFilename; }
+
+        /**
+         * Append events in one write and apply them to the live state
+         * @param payloads the events, all stamped with the current time
+         */
+        void append(const vector<EventPayload>& payloads);
+        void append(const EventPayload& payload) { append(vector<EventPayload>{payload}); }
+
+        /**
+         * Check if the live state already holds a match exactly as given
+         * @param match the match row
+         * @return True if nothing would change (or the log is disabled), else False
+         */
+        bool isRecorded(const MatchScheduledEvent& match);
+
+        /**
+         * Get a player's stage in the live state
+         * @param playerID the player ID
+         * @return the stage, empty if none was recorded
+         */
+        string recordedStage(const string& playerID);
+
+        // Copy of the live state
+        TournamentState state();
+
+        /**
+         * Rebuild the state as it was at a time
+         * Starts from the snapshot when it is older than the time, otherwise from the first record.
+         * @param timestamp seconds since 01-01-1970; records stamped later are not applied
+         */
+        TournamentState stateAsOf(int64_t timestamp);
+
+        // Write a snapshot of the live state now
+        bool writeSnapshot();
+
+        /**
+         * Replay the records of a log file
+         * @param filename the log file
+         * @param fromOffset the offset of the first record to read (0 for the start of the log)
+         * @param asOf the last timestamp to apply
+         * @param state the state the records are applied to
+         * @param validEnd Output: the offset after the last valid record read
+         * @return the number of records applied, -1 if the file is not an event log
+         */
+        static long long replay(const string& filename, uint64_t fromOffset, int64_t asOf,
+                                TournamentState& state, uint64_t& validEnd);
+};
+
+#endif
@@ -0,0 +1,116 @@
+#include "HistoryScan.h"
+#include "Instrumentation.h"
+#include "AsyncWriter.h"
+#include <charconv>
+
+bool parseHistoryRow(string_view line, HistoryRowView& row) {
+    string_view* fields[] = {&row.historyID, &row.matchID, &row.stageID, &row.p1ID, &row.p2ID, &row.score};
+    size_t start = 0;
+    for (string_view* field : fields) {
+        size_t comma = line.find(',', start);
+        if (comma == string_view::npos) return false;
+        *field = line.substr(start, comma - start);
+        start = comma + 1;
+    }
+
+    // The rest is the match time and the duration after the last comma
+    string_view rest = line.substr(start);
+    size_t lastComma = rest.rfind(',');
+    if (lastComma == string_view::npos) {
+        row.matchTime = rest;
+        row.duration = "00:00";
+    } else {
+        row.matchTime = rest.substr(0, lastComma);
+        row.duration = rest.substr(lastComma + 1);
+    }
+    return true;
+}
+
+bool parseHistoryScore(string_view score, int& score1, int& score2) {
+    const char* end = score.data() + score.size();
+    from_chars_result first = from_chars(score.data(), end, score1);
+    if (first.ec != errc() || first.ptr == end) return false;
+    from_chars_result second = from_chars(first.ptr + 1, end, score2);
+    return second.ec == errc();
+}
+
+long long scanHistoryFile(const string& filename, const function<bool(const HistoryRowView&)>& visit,
+                          bool newestFirst, size_t chunkSize) {
+    INSTRUMENT_FILE_SCOPE("scanHistoryFile");
+    syncFile(filename);
+    ifstream file(filename, ios::binary);
+    if (!file) return -1;
+    chunkSize = max(chunkSize, (size_t)1);
+
+    long long visited = 0;
+    bool stopped = false;
+    // Parse and visit one line; False once the visitor asked to stop
+    auto emit = [&](string_view line) {
+        if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+        HistoryRowView row;
+        if (line.empty() || !parseHistoryRow(line, row)) return true;
+        visited++;
+        stopped = !visit(row);
+        return !stopped;
+    };
+
+    vector<char> chunk(chunkSize);
+    string carry;       // A line split over two chunks
+
+    if (!newestFirst) {
+        while (!stopped && (file.read(chunk.data(), chunkSize) || file.gcount() > 0)) {
+            string_view data(chunk.data(), file.gcount());
+            size_t lineStart = 0;
+            size_t newline;
+            while (!stopped && (newline = data.find('\n', lineStart)) != string_view::npos) {
+                string_view line = data.substr(lineStart, newline - lineStart);
+                if (carry.empty()) {
+                    emit(line);
+                } else {
+                    carry.append(line);
+                    emit(carry);
+                    carry.clear();
+                }
+                lineStart = newline + 1;
+            }
+            if (!stopped) carry.append(data.substr(lineStart));
+        }
+        if (!stopped && !carry.empty()) emit(carry);
+        return visited;
+    }
+
+    // Newest first: read chunks from the end; carry holds the start of the line the later chunk began in
+    file.seekg(0, ios::end);
+    uint64_t position = file.tellg();
+    string joined;
+    while (!stopped && position > 0) {
+        size_t length = min<uint64_t>(chunkSize, position);
+        position -= length;
+        file.seekg(position);
+        if (!file.read(chunk.data(), length)) break;
+        string_view data(chunk.data(), length);
+
+        size_t end = length;        // data[.., end) is not visited yet
+        bool joinCarry = true;      // The last line of the chunk continues into the carry
+        while (!stopped) {
+            size_t newline = end == 0 ? string_view::npos : data.rfind('\n', end - 1);
+            if (newline == string_view::npos) {
+                carry.insert(0, data.substr(0, end));
+                break;
+            }
+            string_view line = data.substr(newline + 1, end - newline - 1);
+            if (joinCarry && !carry.empty()) {
+                joined.assign(line);
+                joined += carry;
+                carry.clear();
+                emit(joined);
+            } else {
+                emit(line);
+            }
+            joinCarry = false;
+            end = newline;
+        }
+    }
+    if (!stopped && !carry.empty()) emit(carry);
+    return visited;
+}
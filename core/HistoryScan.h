@@ -0,0 +1,61 @@
+#ifndef CORE_HISTORY_SCAN_H
+#define CORE_HISTORY_SCAN_H
+
+#include "Common.h"
+#include <functional>
+#include <string_view>
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------
+ * ------------------------------------------------- History Scan -------------------------------------------------
+ * ----------------------------------------------------------------------------------------------------------------
+ * Streams MatchHistory.txt through a fixed-size buffer, so a query over an archive of any size needs
+ * one chunk of memory and one pass over the file. Rows are handed out as views into the buffer.
+ *
+ * Row: historyID,matchID,stageID,p1ID,p2ID,score,match time,duration
+ * (the match time may itself contain commas, so the duration is the text after the last comma)
+ */
+
+const size_t HISTORY_SCAN_CHUNK = 1 << 20;     // Bytes read per chunk
+
+// One row of the history file; the views are valid only during the callback
+struct HistoryRowView {
+    string_view historyID;
+    string_view matchID;
+    string_view stageID;
+    string_view p1ID;
+    string_view p2ID;
+    string_view score;
+    string_view matchTime;
+    string_view duration;       // "00:00" when the row has none
+};
+
+/**
+ * Split one history line into its fields
+ * @param line the line, without the newline
+ * @param row Output: the fields
+ * @return True if the line has the six leading fields, else False
+ */
+bool parseHistoryRow(string_view line, HistoryRowView& row);
+
+/**
+ * Read the two scores of a history row
+ * @param score the score field, e.g. "11-7"
+ * @param score1 Output: the first player's score
+ * @param score2 Output: the second player's score
+ * @return True if the field holds two scores, else False
+ */
+bool parseHistoryScore(string_view score, int& score1, int& score2);
+
+/**
+ * Visit every row of a history file
+ * @param filename the history file
+ * @param visit called for each row; return False to stop the scan
+ * @param newestFirst True to visit the last row first (the file is read backwards chunk by chunk)
+ * @param chunkSize bytes read at a time
+ * @return the number of rows visited, -1 if the file cannot be opened
+ */
+long long scanHistoryFile(const string& filename, const function<bool(const HistoryRowView&)>& visit,
+                          bool newestFirst = false, size_t chunkSize = HISTORY_SCAN_CHUNK);
+
+#endif
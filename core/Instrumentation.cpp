@@ -0,0 +1,263 @@
+#include "Instrumentation.h"
+
+#ifdef TOURNAMENT_INSTRUMENT
+
+#include <mutex>
+#include <csignal>
+#include <fcntl.h>
+#include <unistd.h>
+
+static OpStats registeredOps[INSTRUMENT_MAX_OPS];
+static atomic<int> registeredCount(0);
+static mutex registerMutex;
+
+static IoCounters ioBaseline;       // Process totals when the program started
+static IoCounters ioSampleCost;     // What one read of /proc/self/io adds to the totals
+static atomic<uint64_t> ioSamples(0);
+static bool ioAvailable = false;
+static int reportFd = 2;
+
+/**
+ * Read the raw process I/O totals
+ * @param counters the totals
+ * @return True if /proc/self/io could be read, else False
+ */
+static bool readRawIo(IoCounters& counters) {
+    int fd = open("/proc/self/io", O_RDONLY);
+    if (fd < 0) return false;
+    char buffer[512];
+    ssize_t length = read(fd, buffer, sizeof(buffer) - 1);
+    close(fd);
+    if (length <= 0) return false;
+    buffer[length] = '\0';
+
+    counters = IoCounters{0, 0, 0, 0};
+    const char* fields[] = {"rchar:", "wchar:", "syscr:", "syscw:"};
+    uint64_t* values[] = {&counters.bytesRead, &counters.bytesWritten, &counters.readCalls, &counters.writeCalls};
+    for (int i = 0; i < 4; i++) {
+        const char* field = strstr(buffer, fields[i]);
+        if (field) *values[i] = strtoull(field + strlen(fields[i]), nullptr, 10);
+    }
+    return true;
+}
+
+bool Instrumentation::readIo(IoCounters& counters) {
+    if (!ioAvailable) return false;
+    // Earlier samples are taken off, so the totals only show the program's own I/O
+    uint64_t earlier = ioSamples.fetch_add(1, memory_order_relaxed);
+    if (!readRawIo(counters)) return false;
+    counters.bytesRead -= min(counters.bytesRead, earlier * ioSampleCost.bytesRead);
+    counters.bytesWritten -= min(counters.bytesWritten, earlier * ioSampleCost.bytesWritten);
+    counters.readCalls -= min(counters.readCalls, earlier * ioSampleCost.readCalls);
+    counters.writeCalls -= min(counters.writeCalls, earlier * ioSampleCost.writeCalls);
+    return true;
+}
+
+OpStats* Instrumentation::registerOp(const char* name, InstrumentKind kind) {
+    lock_guard<mutex> lock(registerMutex);
+    int count = registeredCount.load(memory_order_relaxed);
+    for (int i = 0; i < count; i++) {
+        if (registeredOps[i].kind == kind && strcmp(registeredOps[i].name, name) == 0) return &registeredOps[i];
+    }
+    // A full registry folds further names into its last entry rather than failing
+    if (count == INSTRUMENT_MAX_OPS) return &registeredOps[INSTRUMENT_MAX_OPS - 1];
+    registeredOps[count].name = name;
+    registeredOps[count].kind = kind;
+    registeredCount.store(count + 1, memory_order_release);
+    return &registeredOps[count];
+}
+
+void Instrumentation::record(OpStats& stats, uint64_t ns) {
+    stats.count.fetch_add(1, memory_order_relaxed);
+    stats.totalNs.fetch_add(ns, memory_order_relaxed);
+    uint64_t previousMax = stats.maxNs.load(memory_order_relaxed);
+    while (ns > previousMax && !stats.maxNs.compare_exchange_weak(previousMax, ns, memory_order_relaxed)) {}
+    int bucket = 0;
+    while (bucket < INSTRUMENT_BUCKETS - 1 && (ns >> (bucket + 1)) != 0) bucket++;
+    stats.buckets[bucket].fetch_add(1, memory_order_relaxed);
+}
+
+/**
+ * Fixed-size line buffer for the report (no heap, no stdio)
+ */
+class ReportLine {
+    private:
+        static const size_t CAPACITY = 255;     // Characters before the newline
+        char text[CAPACITY + 1];
+        size_t length;
+
+        void put(char c) {
+            if (length < CAPACITY) text[length++] = c;
+        }
+
+    public:
+        ReportLine() : length(0) {}
+
+        // Text padded to a width, always followed by at least one space when padded
+        void append(const char* value, size_t width = 0) {
+            size_t start = length;
+            while (*value) put(*value++);
+            if (width > 0) {
+                do {
+                    put(' ');
+                } while (length - start < width && length < CAPACITY);
+            }
+        }
+
+        // Right-aligned unsigned number
+        void number(uint64_t value, size_t width) {
+            char digits[24];
+            size_t count = 0;
+            do {
+                digits[count++] = '0' + value % 10;
+                value /= 10;
+            } while (value);
+            for (size_t i = count; i < width; i++) put(' ');
+            while (count > 0) put(digits[--count]);
+        }
+
+        // Right-aligned nanoseconds shown as microseconds with one decimal
+        void micros(uint64_t ns, size_t width) {
+            number(ns / 1000, width - 2);
+            put('.');
+            put('0' + ns / 100 % 10);
+        }
+
+        void write(int fd) {
+            text[length++] = '\n';
+            ssize_t written = ::write(fd, text, length);
+            (void)written;
+            length = 0;
+        }
+};
+
+/**
+ * Approximate percentile of an operation's latency from its histogram
+ * @param stats the operation
+ * @param count the operation's call count
+ * @param permille the percentile in thousandths (e.g. 990 for p99)
+ * @return the upper bound of the bucket holding the percentile, capped at the maximum
+ */
+static uint64_t percentileNs(const OpStats& stats, uint64_t count, int permille) {
+    uint64_t target = (count * permille + 999) / 1000;
+    uint64_t seen = 0;
+    for (int b = 0; b < INSTRUMENT_BUCKETS; b++) {
+        seen += stats.buckets[b].load(memory_order_relaxed);
+        if (seen >= target) return min(stats.maxNs.load(memory_order_relaxed), (uint64_t(2) << b) - 1);
+    }
+    return stats.maxNs.load(memory_order_relaxed);
+}
+
+void Instrumentation::writeReport(int fd) {
+    int count = registeredCount.load(memory_order_acquire);
+    ReportLine line;
+    line.append("\n=== Instrumentation report (latencies in microseconds) ===");
+    line.write(fd);
+    line.append("Operation", 44);
+    line.append("  Calls      Mean       p50       p90       p99       Max");
+    line.write(fd);
+
+    for (int i = 0; i < count; i++) {
+        const OpStats& stats = registeredOps[i];
+        uint64_t calls = stats.count.load(memory_order_relaxed);
+        if (stats.kind == INSTRUMENT_COUNTER || calls == 0) continue;
+        line.append(stats.name, 44);
+        line.number(calls, 7);
+        line.micros(stats.totalNs.load(memory_order_relaxed) / calls, 10);
+        line.micros(percentileNs(stats, calls, 500), 10);
+        line.micros(percentileNs(stats, calls, 900), 10);
+        line.micros(percentileNs(stats, calls, 990), 10);
+        line.micros(stats.maxNs.load(memory_order_relaxed), 10);
+        line.write(fd);
+        if (stats.kind == INSTRUMENT_FILE) {
+            line.append("    file I/O: read ");
+            line.number(stats.bytesRead.load(memory_order_relaxed), 0);
+            line.append(" B in ");
+            line.number(stats.readCalls.load(memory_order_relaxed), 0);
+            line.append(" calls, wrote ");
+            line.number(stats.bytesWritten.load(memory_order_relaxed), 0);
+            line.append(" B in ");
+            line.number(stats.writeCalls.load(memory_order_relaxed), 0);
+            line.append(" calls");
+            line.write(fd);
+        }
+    }
+
+    bool anyCounter = false;
+    for (int i = 0; i < count; i++) {
+        const OpStats& stats = registeredOps[i];
+        if (stats.kind != INSTRUMENT_COUNTER) continue;
+        if (!anyCounter) {
+            line.append("Counters:");
+            line.write(fd);
+            anyCounter = true;
+        }
+        line.append("  ");
+        line.append(stats.name, 42);
+        line.number(stats.count.load(memory_order_relaxed), 12);
+        line.write(fd);
+    }
+
+    IoCounters now;
+    if (readIo(now)) {
+        line.append("Process I/O: read ");
+        line.number(now.bytesRead - ioBaseline.bytesRead, 0);
+        line.append(" B in ");
+        line.number(now.readCalls - ioBaseline.readCalls, 0);
+        line.append(" read calls, wrote ");
+        line.number(now.bytesWritten - ioBaseline.bytesWritten, 0);
+        line.append(" B in ");
+        line.number(now.writeCalls - ioBaseline.writeCalls, 0);
+        line.append(" write calls");
+        line.write(fd);
+    }
+}
+
+/**
+ * Write the report and, for SIGINT/SIGTERM, end the program the way the signal would have
+ * @param signalNumber the signal
+ */
+static void reportOnSignal(int signalNumber) {
+    Instrumentation::writeReport(reportFd);
+    if (signalNumber != SIGUSR1) {
+        signal(signalNumber, SIG_DFL);
+        raise(signalNumber);
+    }
+}
+
+static void reportOnExit() {
+    Instrumentation::writeReport(reportFd);
+}
+
+/**
+ * Sets up the I/O baseline and the report triggers when the program starts
+ */
+static struct InstrumentationSetup {
+    InstrumentationSetup() {
+        IoCounters first, second;
+        if (readRawIo(first) && readRawIo(second)) {
+            ioAvailable = true;
+            ioSampleCost = IoCounters{second.bytesRead - first.bytesRead, second.bytesWritten - first.bytesWritten,
+                                      second.readCalls - first.readCalls, second.writeCalls - first.writeCalls};
+            Instrumentation::readIo(ioBaseline);
+        }
+
+        const char* reportFile = getenv("TOURNAMENT_INSTRUMENT_REPORT");
+        if (reportFile && *reportFile) {
+            int fd = open(reportFile, O_WRONLY | O_CREAT | O_APPEND, 0644);
+            if (fd >= 0) reportFd = fd;
+        }
+
+        atexit(reportOnExit);
+        struct sigaction action;
+        memset(&action, 0, sizeof(action));
+        action.sa_handler = reportOnSignal;
+        action.sa_flags = SA_RESTART;
+        sigemptyset(&action.sa_mask);
+        sigaction(SIGUSR1, &action, nullptr);
+        sigaction(SIGINT, &action, nullptr);
+        sigaction(SIGTERM, &action, nullptr);
+    }
+} instrumentationSetup;
+
+#endif
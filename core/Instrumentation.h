@@ -0,0 +1,149 @@
+#ifndef CORE_INSTRUMENTATION_H
+#define CORE_INSTRUMENTATION_H
+
+#include "Common.h"
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------
+ * ------------------------------------------------ Instrumentation -----------------------------------------------
+ * ----------------------------------------------------------------------------------------------------------------
+ * Compiled in only when TOURNAMENT_INSTRUMENT is defined (cmake -DTOURNAMENT_INSTRUMENTATION=ON);
+ * otherwise every macro below expands to nothing.
+ *
+ *   INSTRUMENT_SCOPE("name")       time the enclosing scope into the operation's latency histogram
+ *   INSTRUMENT_FILE_SCOPE("name")  the same, plus the file I/O bytes and read/write syscalls made in the scope
+ *   INSTRUMENT_COUNT("name", n)    add n to a counter
+ *
+ * The report goes to stderr (or the file named by TOURNAMENT_INSTRUMENT_REPORT) at exit,
+ * on SIGUSR1 (the program carries on) and on SIGINT/SIGTERM.
+ */
+#ifdef TOURNAMENT_INSTRUMENT
+
+#include <atomic>
+
+const int INSTRUMENT_BUCKETS = 40;      // Bucket b counts latencies in [2^b, 2^(b+1)) nanoseconds
+const int INSTRUMENT_MAX_OPS = 128;     // Distinct operation names
+
+enum InstrumentKind { INSTRUMENT_TIMER, INSTRUMENT_FILE, INSTRUMENT_COUNTER };
+
+// Process file I/O totals as reported by /proc/self/io
+struct IoCounters {
+    uint64_t bytesRead;
+    uint64_t bytesWritten;
+    uint64_t readCalls;
+    uint64_t writeCalls;
+};
+
+// Statistics of one instrumented operation or counter
+struct OpStats {
+    const char* name;
+    InstrumentKind kind;
+    atomic<uint64_t> count;
+    atomic<uint64_t> totalNs;
+    atomic<uint64_t> maxNs;
+    atomic<uint64_t> buckets[INSTRUMENT_BUCKETS];
+    atomic<uint64_t> bytesRead;
+    atomic<uint64_t> bytesWritten;
+    atomic<uint64_t> readCalls;
+    atomic<uint64_t> writeCalls;
+};
+
+/**
+ * Registry of the instrumented operations and the report writer
+ */
+class Instrumentation {
+    public:
+        /**
+         * Get the statistics of an operation, registering it on first use
+         * @param name the operation name (a string literal, it is kept by pointer)
+         * @param kind timer, file operation or counter
+         */
+        static OpStats* registerOp(const char* name, InstrumentKind kind);
+
+        /**
+         * Add one timed call to an operation
+         * @param stats the operation
+         * @param ns the call's duration in nanoseconds
+         */
+        static void record(OpStats& stats, uint64_t ns);
+
+        /**
+         * Read the process I/O totals
+         * @param counters the totals, with the cost of reading them already taken off
+         * @return True if /proc/self/io could be read, else False
+         */
+        static bool readIo(IoCounters& counters);
+
+        /**
+         * Write the report; uses only write(2) and stack buffers, so it is safe in a signal handler
+         * @param fd the file descriptor to write to
+         */
+        static void writeReport(int fd);
+};
+
+// Times a scope into an operation
+class ScopedTimer {
+    private:
+        OpStats& stats;
+        chrono::steady_clock::time_point start;
+
+    public:
+        ScopedTimer(OpStats& op) : stats(op), start(chrono::steady_clock::now()) {}
+        ~ScopedTimer() {
+            Instrumentation::record(stats, chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count());
+        }
+        ScopedTimer(const ScopedTimer&) = delete;
+        ScopedTimer& operator=(const ScopedTimer&) = delete;
+};
+
+// Times a scope into a file operation and adds the I/O made in the scope
+class ScopedFileTimer {
+    private:
+        OpStats& stats;
+        IoCounters before;
+        bool haveIo;
+        chrono::steady_clock::time_point start;
+
+    public:
+        ScopedFileTimer(OpStats& op) : stats(op), haveIo(Instrumentation::readIo(before)), start(chrono::steady_clock::now()) {}
+        ~ScopedFileTimer() {
+            uint64_t ns = chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count();
+            IoCounters after;
+            if (haveIo && Instrumentation::readIo(after)) {
+                stats.bytesRead.fetch_add(after.bytesRead - before.bytesRead, memory_order_relaxed);
+                stats.bytesWritten.fetch_add(after.bytesWritten - before.bytesWritten, memory_order_relaxed);
+                stats.readCalls.fetch_add(after.readCalls - before.readCalls, memory_order_relaxed);
+                stats.writeCalls.fetch_add(after.writeCalls - before.writeCalls, memory_order_relaxed);
+            }
+            Instrumentation::record(stats, ns);
+        }
+        ScopedFileTimer(const ScopedFileTimer&) = delete;
+        ScopedFileTimer& operator=(const ScopedFileTimer&) = delete;
+};
+
+#define INSTRUMENT_CONCAT_(a, b) a##b
+#define INSTRUMENT_CONCAT(a, b) INSTRUMENT_CONCAT_(a, b)
+
+#define INSTRUMENT_SCOPE(name) \
+    static OpStats* const INSTRUMENT_CONCAT(instrumentOp, __LINE__) = Instrumentation::registerOp(name, INSTRUMENT_TIMER); \
+    ScopedTimer INSTRUMENT_CONCAT(instrumentTimer, __LINE__)(*INSTRUMENT_CONCAT(instrumentOp, __LINE__))
+
+#define INSTRUMENT_FILE_SCOPE(name) \
+    static OpStats* const INSTRUMENT_CONCAT(instrumentOp, __LINE__) = Instrumentation::registerOp(name, INSTRUMENT_FILE); \
+    ScopedFileTimer INSTRUMENT_CONCAT(instrumentTimer, __LINE__)(*INSTRUMENT_CONCAT(instrumentOp, __LINE__))
+
+#define INSTRUMENT_COUNT(name, n) \
+    do { \
+        static OpStats* const instrumentCounter = Instrumentation::registerOp(name, INSTRUMENT_COUNTER); \
+        instrumentCounter -> count.fetch_add((n), memory_order_relaxed); \
+    } while (0)
+
+#else
+
+#define INSTRUMENT_SCOPE(name) ((void)0)
+#define INSTRUMENT_FILE_SCOPE(name) ((void)0)
+#define INSTRUMENT_COUNT(name, n) ((void)0)
+
+#endif
+
+#endif
@@ -0,0 +1,194 @@
+#include "Logger.h"
+
+/**
+ * Get the level named by a string
+ * @param name debug, info, warn, error or off
+ * @param fallback the level for an unknown name
+ */
+static LogLevel parseLogLevel(const string& name, LogLevel fallback) {
+    if (name == "debug") return LOG_DEBUG;
+    if (name == "info") return LOG_INFO;
+    if (name == "warn") return LOG_WARN;
+    if (name == "error") return LOG_ERROR;
+    if (name == "off") return LOG_OFF;
+    return fallback;
+}
+
+static const char* logLevelName(LogLevel level) {
+    switch (level) {
+        case LOG_DEBUG: return "debug";
+        case LOG_INFO: return "info";
+        case LOG_WARN: return "warn";
+        case LOG_ERROR: return "error";
+        default: return "off";
+    }
+}
+
+/**
+ * Append a string as a JSON string literal
+ * @param out the text to append to
+ * @param value the string
+ */
+static void appendJson(string& out, const string& value) {
+    out += '"';
+    for (char c : value) {
+        switch (c) {
+            case '"': out += "\\\""; break;
+            case '\\': out += "\\\\"; break;
+            case '\n': out += "\\n"; break;
+            case '\t': out += "\\t"; break;
+            case '\r': out += "\\r"; break;
+            default:
+                if ((unsigned char)c < 0x20) {
+                    char escaped[8];
+                    snprintf(escaped, sizeof(escaped), "\\u%04x", (unsigned char)c);
+                    out += escaped;
+                } else {
+                    out += c;
+                }
+        }
+    }
+    out += '"';
+}
+
+/**
+ * Trim the blank lines the console messages start and end with
+ * @param message the console text
+ */
+static string trimMessage(const string& message) {
+    size_t first = message.find_first_not_of(" \n");
+    if (first == string::npos) return "";
+    size_t last = message.find_last_not_of(" \n");
+    return message.substr(first, last - first + 1);
+}
+
+Logger::Logger() : consoleLevel(LOG_INFO), quiet(false), hasEventFile(false),
+                   queuedCount(0), writtenCount(0), async(false), stopping(false) {
+    const char* level = getenv("TOURNAMENT_LOG_LEVEL");
+    if (level) consoleLevel = parseLogLevel(level, LOG_INFO);
+    const char* quietMode = getenv("TOURNAMENT_LOG_QUIET");
+    if (quietMode && string(quietMode) == "1") quiet = true;
+    const char* eventFilename = getenv("TOURNAMENT_LOG_FILE");
+    if (eventFilename && *eventFilename) setEventFile(eventFilename);
+    const char* asyncMode = getenv("TOURNAMENT_LOG_ASYNC");
+    if (asyncMode && string(asyncMode) == "1") startAsync();
+}
+
+Logger& Logger::instance() {
+    static Logger logger;
+    return logger;
+}
+
+Logger::~Logger() {
+    stopAsync();
+    flush();
+}
+
+bool Logger::setEventFile(const string& filename) {
+    lock_guard<mutex> lock(queueMutex);
+    if (eventFile.is_open()) eventFile.close();
+    eventFile.open(filename, ios::app);
+    hasEventFile = eventFile.is_open();
+    return hasEventFile;
+}
+
+void Logger::format(const LogEvent& event, string& consoleText, string& eventLines) const {
+    if (printsToConsole(event.level)) consoleText += event.message;
+    if (!hasEventFile) return;
+    eventLines += "{\"ts\":" + to_string(event.timestampMs) + ",\"level\":\"" + logLevelName(event.level) + "\",\"event\":";
+    appendJson(eventLines, event.event);
+    eventLines += ",\"message\":";
+    appendJson(eventLines, trimMessage(event.message));
+    for (const LogField& field : event.fields) {
+        eventLines += ',';
+        appendJson(eventLines, field.key);
+        eventLines += ':';
+        appendJson(eventLines, field.value);
+    }
+    eventLines += "}\n";
+}
+
+void Logger::writeOut(const string& consoleText, const string& eventLines) {
+    if (!consoleText.empty()) {
+        cout << consoleText;
+        if (async) cout.flush();
+    }
+    if (!eventLines.empty()) {
+        eventFile << eventLines;
+        if (async) eventFile.flush();
+    }
+}
+
+void Logger::log(LogLevel level, const string& event, const string& message, vector<LogField> fields) {
+    if (!enabled(level)) return;
+    LogEvent record{level, 0, event, message, move(fields)};
+    if (hasEventFile) {
+        record.timestampMs = chrono::duration_cast<chrono::milliseconds>(chrono::system_clock::now().time_since_epoch()).count();
+    }
+
+    if (async) {
+        lock_guard<mutex> lock(queueMutex);
+        pending.push_back(move(record));
+        queuedCount++;
+        // The writer is woken for the first event of a batch only
+        if (pending.size() == 1) wakeWriter.notify_one();
+        return;
+    }
+
+    // Synchronous: written straight away, but the stream is not flushed per event
+    string consoleText, eventLines;
+    format(record, consoleText, eventLines);
+    writeOut(consoleText, eventLines);
+}
+
+void Logger::runWriter() {
+    vector<LogEvent> batch;
+    string consoleText, eventLines;
+    unique_lock<mutex> lock(queueMutex);
+    while (true) {
+        wakeWriter.wait(lock, [this]() { return stopping || !pending.empty(); });
+        if (pending.empty() && stopping) break;
+        batch.swap(pending);
+        lock.unlock();
+
+        consoleText.clear();
+        eventLines.clear();
+        for (const LogEvent& event : batch) format(event, consoleText, eventLines);
+        writeOut(consoleText, eventLines);
+
+        lock.lock();
+        writtenCount += batch.size();
+        batch.clear();
+        batchWritten.notify_all();
+    }
+}
+
+void Logger::startAsync() {
+    lock_guard<mutex> lock(queueMutex);
+    if (async) return;
+    stopping = false;
+    async = true;
+    writer = thread(&Logger::runWriter, this);
+}
+
+void Logger::stopAsync() {
+    {
+        lock_guard<mutex> lock(queueMutex);
+        if (!async) return;
+        stopping = true;
+    }
+    wakeWriter.notify_one();
+    writer.join();
+    lock_guard<mutex> lock(queueMutex);
+    async = false;
+    stopping = false;
+}
+
+void Logger::flush() {
+    {
+        unique_lock<mutex> lock(queueMutex);
+        if (async) batchWritten.wait(lock, [this]() { return writtenCount == queuedCount; });
+    }
+    cout.flush();
+    if (hasEventFile) eventFile.flush();
+}
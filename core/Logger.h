@@ -0,0 +1,127 @@
+#ifndef CORE_LOGGER_H
+#define CORE_LOGGER_H
+
+#include "Common.h"
+#include <mutex>
+#include <condition_variable>
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------
+ * ---------------------------------------------------- Logging ---------------------------------------------------
+ * ----------------------------------------------------------------------------------------------------------------
+ * Levelled, structured event logging for the console messages of the hot paths.
+ * By default every message is printed to cout as before, without flushing per event.
+ * Batch runs can raise the console level (quiet mode) and move the output to a background
+ * writer thread; events can also be written as JSON lines to a file.
+ *
+ * Environment: TOURNAMENT_LOG_LEVEL (debug, info, warn, error, off), TOURNAMENT_LOG_QUIET=1,
+ * TOURNAMENT_LOG_ASYNC=1 and TOURNAMENT_LOG_FILE=<path of the JSON lines file>.
+ */
+enum LogLevel { LOG_DEBUG, LOG_INFO, LOG_WARN, LOG_ERROR, LOG_OFF };
+
+// One key and value of a structured event
+struct LogField {
+    string key;
+    string value;
+};
+
+// A structured event
+struct LogEvent {
+    LogLevel level;
+    long long timestampMs;      // Milliseconds since 01-01-1970 (UTC)
+    string event;               // Event name e.g. ticket.purchased
+    string message;             // Console text, printed exactly as given
+    vector<LogField> fields;
+};
+
+class Logger {
+    private:
+        LogLevel consoleLevel;      // Lowest level printed to the console
+        bool quiet;                 // Only warnings and errors reach the console
+        ofstream eventFile;
+        bool hasEventFile;
+
+        // Background writer
+        mutex queueMutex;
+        condition_variable wakeWriter;
+        condition_variable batchWritten;
+        vector<LogEvent> pending;
+        unsigned long long queuedCount;
+        unsigned long long writtenCount;
+        bool async;
+        bool stopping;
+        thread writer;
+
+        Logger();
+
+        bool printsToConsole(LogLevel level) const {
+            return level >= consoleLevel && (!quiet || level >= LOG_WARN);
+        }
+
+        // Append an event to the console text and the JSON lines of a batch
+        void format(const LogEvent& event, string& consoleText, string& eventLines) const;
+
+        // Write a formatted batch, one write per sink
+        void writeOut(const string& consoleText, const string& eventLines);
+
+        // Background writer loop
+        void runWriter();
+
+    public:
+        static Logger& instance();
+        ~Logger();
+        Logger(const Logger&) = delete;
+        Logger& operator=(const Logger&) = delete;
+
+        void setLevel(LogLevel level) { consoleLevel = level; }
+        void setQuiet(bool isQuiet) { quiet = isQuiet; }
+
+        /**
+         * Write every event (whatever the console level) to a JSON lines file
+         * @param filename the file, appended to
+         * @return True if the file could be opened, else False
+         */
+        bool setEventFile(const string& filename);
+
+        // Start the background writer; events logged afterwards are written in batches
+        void startAsync();
+
+        // Write out everything queued and stop the background writer
+        void stopAsync();
+
+        // Wait until every event logged so far has been written
+        void flush();
+
+        /**
+         * Check if an event of a level would be written anywhere, so callers can skip formatting it
+         * @param level the event level
+         */
+        bool enabled(LogLevel level) const {
+            return printsToConsole(level) || (hasEventFile && level < LOG_OFF);
+        }
+
+        /**
+         * Log an event
+         * @param level the event level
+         * @param event the event name
+         * @param message the console text
+         * @param fields the structured fields
+         */
+        void log(LogLevel level, const string& event, const string& message, vector<LogField> fields = {});
+};
+
+/**
+ * Log an event, formatting its message only when the event is written anywhere
+ * e.g. LOG_EVENT(LOG_INFO, "ticket.purchased", "Ticket " << id << "\n", {"ticketID", id});
+ */
+#define LOG_EVENT(level, event, text, ...) \
+    do { \
+        Logger& eventLogger = Logger::instance(); \
+        if (eventLogger.enabled(level)) { \
+            ostringstream eventText; \
+            eventText << text; \
+            eventLogger.log(level, event, eventText.str(), {__VA_ARGS__}); \
+        } \
+    } while (0)
+
+#endif
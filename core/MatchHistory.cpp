@@ -0,0 +1,750 @@
+#include "MatchHistory.h"
+
+/** ---- MatchScores ---- */
+
+MatchScores::MatchScores(string id, string stage, string round, string player1, string player2, string court, MatchTime scheduled) {
+    matchID = id;
+    stageID = stage;
+    roundID = round;
+    p1ID = player1;
+    p2ID = player2;
+    score1 = 0;
+    score2 = 0;
+    winner = "";
+    scheduledTime = scheduled;
+    matchStatus = "waiting";
+    courtID = court;
+
+    // Get current time for matchTime
+    matchTime = currentMatchTime();
+
+    // Assuming match duration to be zero initially
+    matchDuration = "00:00"; 
+}
+
+/** ---- MatchHistoryStack ---- */
+
+MatchHistoryStack::~MatchHistoryStack() {
+    while (!isEmpty()) {
+        pop();
+    }
+}
+
+void MatchHistoryStack::push(MatchHistory mh) {
+    Node* newNode = new Node(mh);
+    newNode->next = topNode;
+    topNode = newNode;
+    stackSize++;
+}
+
+MatchHistory MatchHistoryStack::pop() {
+    if (isEmpty()) {
+        throw runtime_error("Stack is empty");
+    }
+    
+    Node* temp = topNode;
+    MatchHistory mh = temp->data;
+    topNode = topNode->next;
+    delete temp;
+    stackSize--;
+    return mh;
+}
+
+MatchHistory MatchHistoryStack::peek() {
+    if (isEmpty()) {
+        throw runtime_error("Stack is empty");
+    }
+    return topNode->data;
+}
+
+bool MatchHistoryStack::isEmpty() {
+    return topNode == nullptr;
+}
+
+int MatchHistoryStack::size() {
+    return stackSize;
+}
+
+void MatchHistoryStack::forEach(void (*func)(MatchHistory&)) {
+    Node* current = topNode;
+    while (current != nullptr) {
+        func(current->data);
+        current = current->next;
+    }
+}
+
+/** ---- MatchHistoryManager ---- */
+
+string MatchHistoryManager::formatDuration(int minutes, int seconds) {
+    stringstream ss;
+    ss << setw(2) << setfill('0') << minutes << ":"
+    << setw(2) << setfill('0') << seconds;
+    return ss.str();
+}
+
+MatchHistory MatchHistoryManager::createHistoryFromMatch(MatchScores& match) {
+    MatchHistory mh;
+    mh.historyID = generateHistoryID();
+    mh.matchID = match.matchID;
+    mh.stageID = match.stageID;
+    mh.p1ID = match.p1ID;
+    mh.p2ID = match.p2ID;
+    
+    // Format score
+    stringstream ss;
+    ss << match.score1 << "-" << match.score2;
+    mh.score = ss.str();
+    
+    mh.matchTime = match.matchTime;
+    mh.matchDuration = match.matchDuration;
+    
+    return mh;
+}
+
+void MatchHistoryManager::updateMatchesFile(MatchScores& updatedMatch) {
+    INSTRUMENT_FILE_SCOPE("MatchHistoryManager::updateMatchesFile");
+    syncFile("Matches.txt");
+    ifstream inFile("Matches.txt");
+    ofstream tempFile("Matches_temp.txt");
+    
+    if (!inFile || !tempFile) {
+        LOG_EVENT(LOG_ERROR, "matches.saveFailed", "Error: Unable to update Matches.txt\n", {"matchID", updatedMatch.matchID});
+        return;
+    }
+    
+    string line;
+    while (getline(inFile, line)) {
+        stringstream ss(line);
+        string id;
+        getline(ss, id, ',');
+        
+        if (id == updatedMatch.matchID) {
+            // Write the updated match
+            tempFile << updatedMatch.matchID << ","
+                    << updatedMatch.stageID << ","
+                    << updatedMatch.roundID << ","
+                    << updatedMatch.p1ID << ","
+                    << updatedMatch.p2ID << ","
+                    << formatMatchTime(updatedMatch.scheduledTime) << ","
+                    << updatedMatch.matchStatus << ","
+                    << updatedMatch.courtID << "\n";
+        } else {
+            // Write the original line
+            tempFile << line << "\n";
+        }
+    }
+    
+    inFile.close();
+    tempFile.close();
+    
+    // Replace the old file with the new one
+    remove("Matches.txt");
+    rename("Matches_temp.txt", "Matches.txt");
+    EventLog::instance().append(MatchScheduledEvent{updatedMatch.matchID, updatedMatch.stageID, updatedMatch.roundID,
+                                                    updatedMatch.p1ID, updatedMatch.p2ID, updatedMatch.scheduledTime,
+                                                    updatedMatch.matchStatus, updatedMatch.courtID});
+}
+
+bool MatchHistoryManager::shouldStream(const string& filename) {
+    const char* mode = getenv("TOURNAMENT_HISTORY_STREAMING");
+    if (mode && string(mode) == "on") return true;
+    if (mode && string(mode) == "off") return false;
+    struct stat info;
+    return stat(filename.c_str(), &info) == 0 && info.st_size > HISTORY_STREAMING_THRESHOLD;
+}
+
+int MatchHistoryManager::idNumber(string_view id) {
+    int number = 0;
+    for (size_t i = 1; i < id.size() && isdigit((unsigned char)id[i]); i++) number = number * 10 + (id[i] - '0');
+    return number;
+}
+
+void MatchHistoryManager::scanStreamedHistory(const string& filename) {
+    INSTRUMENT_FILE_SCOPE("MatchHistoryManager::scanStreamedHistory");
+    ratings.clear();
+    winRates.clear();
+    long long rows = scanHistoryFile(filename, [this](const HistoryRowView& row) {
+        historyCounter = max(historyCounter, idNumber(row.historyID) + 1);
+        matchCounter = max(matchCounter, idNumber(row.matchID) + 1);
+        ratings.applyHistoryRow(row);
+        winRates.applyHistoryRow(row);
+        return true;
+    });
+    ratings.finishRecompute();
+    streamedCount = max(rows, 0LL);
+    cout << "Streaming " << streamedCount << " match history records from " << filename << ".\n";
+}
+
+void MatchHistoryManager::commitHistoryEntry(const MatchHistory& mh) {
+    if (streaming) {
+        AsyncFileWriter::instance().append("MatchHistory.txt", mh.historyID + "," + mh.matchID + "," + mh.stageID + ","
+                                           + mh.p1ID + "," + mh.p2ID + "," + mh.score + ","
+                                           + formatMatchTime(mh.matchTime) + "," + mh.matchDuration + "\n");
+        streamedCount++;
+        return;
+    }
+    history.push(mh);
+    saveMatchHistoryToFile("MatchHistory.txt");
+}
+
+void MatchHistoryManager::printSearchRow(const HistoryRowView& row, bool withStage) {
+    cout << "Match ID: " << row.matchID;
+    if (withStage) cout << ", Stage: " << row.stageID;
+    cout << endl;
+    cout << "Players: " << row.p1ID << " vs " << row.p2ID << endl;
+    cout << "Score: " << row.score << endl;
+    cout << "Time: " << formatMatchTime(parseMatchTime(string(row.matchTime))) << endl;
+    cout << "Duration: " << row.duration << endl;
+    cout << string(80, '-') << endl;
+}
+
+MatchHistoryManager::MatchHistoryManager()
+    : streaming(shouldStream("MatchHistory.txt")), streamedCount(0), matchCounter(1), historyCounter(1) {
+    // Try to load existing history if available
+    if (streaming) {
+        scanStreamedHistory("MatchHistory.txt");
+        bracket.load();
+    } else {
+        loadMatchHistoryFromFile("MatchHistory.txt");
+        bracket.load();
+        ratings.recomputeFromHistory("MatchHistory.txt");
+        winRates.loadFromHistory("MatchHistory.txt");
+    }
+}
+
+string MatchHistoryManager::generateMatchID() {
+    ostringstream ss;
+    ss << "M" << setw(3) << setfill('0') << matchCounter++;
+    return ss.str();
+}
+
+string MatchHistoryManager::generateHistoryID() {
+    ostringstream ss;
+    ss << "H" << setw(3) << setfill('0') << historyCounter++;
+    return ss.str();
+}
+
+void MatchHistoryManager::recordMatch() {
+    string matchID;
+    int score1, score2;
+    string duration;
+    
+    // Get minimal input from the user
+    cout << "Enter Match ID: ";
+    cin >> matchID;
+    cout << "Enter Player 1 Score: ";
+    cin >> score1;
+    cout << "Enter Player 2 Score: ";
+    cin >> score2;
+    cout << "Enter Match Duration (MM:SS): ";
+    cin >> duration;
+    MatchHistory recorded;
+    recordResult(matchID, score1, score2, duration, recorded);
+}
+
+bool MatchHistoryManager::findScheduledMatch(const string& matchID, MatchScores& match) {
+    syncFile("Matches.txt");
+    ifstream matchFile("Matches.txt");
+    string line;
+    while (getline(matchFile, line)) {
+        stringstream ss(line);
+        string id, stageID, roundID, p1ID, p2ID, scheduledTime, status, courtID;
+
+        getline(ss, id, ',');
+        if (id != matchID) continue;
+        getline(ss, stageID, ',');
+        getline(ss, roundID, ',');
+        getline(ss, p1ID, ',');
+        getline(ss, p2ID, ',');
+        getline(ss, scheduledTime, ',');
+        getline(ss, status, ',');
+        getline(ss, courtID);
+        if (!courtID.empty() && courtID.back() == '\r') courtID.pop_back();
+        // A bye has no match to play
+        if (status == DRAW_BYE_STATUS) return false;
+
+        match.matchID = id;
+        match.stageID = stageID;
+        match.roundID = roundID;
+        match.p1ID = p1ID;
+        match.p2ID = p2ID;
+        match.scheduledTime = parseMatchTime(scheduledTime);
+        match.matchStatus = status;
+        match.courtID = courtID;
+        return true;
+    }
+    return false;
+}
+
+bool MatchHistoryManager::recordResult(const string& matchID, int score1, int score2, const string& duration, MatchHistory& recorded) {
+    INSTRUMENT_SCOPE("recordMatch");
+
+    // The stage, players and court come from the scheduled match
+    MatchScores newMatch;
+    if (!findScheduledMatch(matchID, newMatch)) {
+        cout << "Match ID " << matchID << " not found in database. The result was not recorded." << endl;
+        return false;
+    }
+    // A tennis match always has a winner
+    if (score1 == score2) {
+        cout << "Scores " << score1 << "-" << score2 << " have no winner. The result was not recorded." << endl;
+        return false;
+    }
+
+    // Current time, written to the files as DD-MM-YYYY HH:MM
+    MatchTime recordedTime = currentMatchTime();
+
+    // Complete the match record
+    newMatch.score1 = score1;
+    newMatch.score2 = score2;
+    newMatch.matchTime = recordedTime;
+    newMatch.matchStatus = "completed";  // Since we're recording final scores
+    newMatch.matchDuration = duration;   // Use user-provided duration
+    newMatch.winner = (score1 > score2) ? newMatch.p1ID : newMatch.p2ID;
+
+    // Create history entry and keep it
+    recorded = createHistoryFromMatch(newMatch);
+    commitHistoryEntry(recorded);
+    
+    cout << "Match recorded and added to history successfully!" << endl;
+    cout << "Match details: " << matchID << ", " 
+        << newMatch.p1ID << " vs " << newMatch.p2ID << ", "
+        << "Score: " << score1 << "-" << score2 << ", "
+        << "Winner: " << newMatch.winner << endl;
+    cout << "Time: " << formatMatchTime(recordedTime) << endl;
+    cout << "Duration: " << duration << endl;
+    
+    EventLog::instance().append(ResultRecordedEvent{matchID, newMatch.stageID, newMatch.p1ID, newMatch.p2ID,
+                                                    score1, score2, recordedTime, duration});
+
+    // Move the winner up the knockout bracket, reloaded first if a new draw replaced it
+    bracket.refresh();
+    bracket.reportResult(matchID, newMatch.winner);
+    ratings.applyResult(newMatch.p1ID, newMatch.p2ID, score1, score2);
+    winRates.recordResult(newMatch.p1ID, newMatch.p2ID, newMatch.winner);
+    return true;
+}
+
+void MatchHistoryManager::updateMatchStatus() {
+    string matchID;
+    cout << "Enter Match ID to update: ";
+    cin >> matchID;
+    
+    // First check if this match exists in our files
+    MatchScores match;
+    bool matchFound = findScheduledMatch(matchID, match);
+    
+    if (!matchFound) {
+        cout << "Match ID " << matchID << " not found in database." << endl;
+        return;
+    }
+    
+    cout << "Current match details:" << endl;
+    cout << "Match ID: " << match.matchID << endl;
+    cout << "Stage ID: " << match.stageID << endl;
+    cout << "Player 1: " << match.p1ID << endl;
+    cout << "Player 2: " << match.p2ID << endl;
+    cout << "Current status: " << match.matchStatus << endl;
+    
+    cout << "\nEnter new status (waiting/ongoing/completed): ";
+    string newStatus;
+    cin >> newStatus;
+    
+    if (newStatus != "waiting" && newStatus != "ongoing" && newStatus != "completed") {
+        cout << "Invalid status. Must be waiting, ongoing, or completed." << endl;
+        return;
+    }
+    
+    match.matchStatus = newStatus;
+    
+    // If status is completed, ask for scores
+    if (match.matchStatus == "completed") {
+        cout << "Enter Player 1 score: ";
+        cin >> match.score1;
+        cout << "Enter Player 2 score: ";
+        cin >> match.score2;
+        cout << "Enter match duration (MM:SS): ";
+        cin >> match.matchDuration;
+        
+        // Current time for the match time
+        match.matchTime = currentMatchTime();
+        
+        // Determine winner
+        match.winner = (match.score1 > match.score2) ? match.p1ID : match.p2ID;
+        
+        // Create history entry and keep it (history file only)
+        MatchHistory mh = createHistoryFromMatch(match);
+        commitHistoryEntry(mh);
+        EventLog::instance().append(ResultRecordedEvent{match.matchID, match.stageID, match.p1ID, match.p2ID,
+                                                        match.score1, match.score2, match.matchTime, match.matchDuration});
+
+        // Move the winner up the knockout bracket, reloaded first if a new draw replaced it
+        bracket.refresh();
+        bracket.reportResult(match.matchID, match.winner);
+        ratings.applyResult(match.p1ID, match.p2ID, match.score1, match.score2);
+        winRates.recordResult(match.p1ID, match.p2ID, match.winner);
+        
+        cout << "Match completed and added to history!" << endl;
+    }
+    
+    // Update the matches file
+    updateMatchesFile(match);
+    
+    cout << "Match status updated to: " << match.matchStatus << endl;
+}
+
+void MatchHistoryManager::simulateMatch(MatchScores& match) {
+    cout << "\n--- Match Simulation ---" << endl;
+    match.matchStatus = "ongoing";
+    
+    time_t startTime = time(0); // Record start time for duration calculation
+    
+    // Simulate play until a winner is determined
+    while (true) {
+        cout << match.p1ID << " (" << match.score1 << ") vs " 
+            << match.p2ID << " (" << match.score2 << ")\n";
+
+        cout << "Player get point (Enter Player ID): ";
+        string player;
+        cin >> player;
+
+        if (player == match.p1ID) {
+            match.score1++;
+        } else if (player == match.p2ID) {
+            match.score2++;
+        } else {
+            cout << "Invalid player ID. Try again.\n";
+            continue;
+        }
+
+        // Check for winner - tennis rules typically require winning by 2 points
+        if ((match.score1 >= 11 || match.score2 >= 11) && abs(match.score1 - match.score2) >= 2) {
+            match.winner = (match.score1 > match.score2) ? match.p1ID : match.p2ID;
+            match.matchStatus = "completed";
+            break;
+        }
+    }
+    
+    // Calculate match duration
+    time_t endTime = time(0);
+    int durationSeconds = difftime(endTime, startTime);
+    int minutes = durationSeconds / 60;
+    int seconds = durationSeconds % 60;
+    match.matchDuration = formatDuration(minutes, seconds);
+    
+    cout << "Match completed! Winner: " << match.winner << endl;
+    cout << "Final score: " << match.score1 << "-" << match.score2 << endl;
+    cout << "Match duration: " << match.matchDuration << endl;
+}
+
+WriteHandle MatchHistoryManager::saveMatchToFile(MatchScores& match) {
+    INSTRUMENT_FILE_SCOPE("MatchHistoryManager::saveMatchToFile");
+    return AsyncFileWriter::instance().append("Matches.txt", match.matchID + "," + match.stageID + "," + match.roundID + ","
+                                              + match.p1ID + "," + match.p2ID + "," + formatMatchTime(match.scheduledTime) + ","
+                                              + match.matchStatus + "," + match.courtID + "\n");
+}
+
+WriteHandle MatchHistoryManager::saveMatchHistoryToFile(const string &filename) {
+    INSTRUMENT_FILE_SCOPE("MatchHistoryManager::saveMatchHistoryToFile");
+    // Create a temporary stack and copy all elements
+    MatchHistoryStack tempStack;
+    MatchHistoryStack backupStack;
+    
+    while (!history.isEmpty()) {
+        MatchHistory mh = history.pop();
+        tempStack.push(mh);
+        backupStack.push(mh);
+    }
+    
+    // Restore original stack
+    while (!backupStack.isEmpty()) {
+        history.push(backupStack.pop());
+    }
+    
+    // Write from temp stack to file (this reverses the order back to chronological)
+    string contents;
+    while (!tempStack.isEmpty()) {
+        MatchHistory mh = tempStack.pop();
+        contents += mh.historyID + "," + mh.matchID + "," + mh.stageID + "," + mh.p1ID + "," + mh.p2ID + ","
+                    + mh.score + "," + formatMatchTime(mh.matchTime) + "," + mh.matchDuration + "\n";
+    }
+
+    WriteHandle saved = AsyncFileWriter::instance().rewrite(filename, move(contents));
+    cout << "Match history saved successfully to " << filename << "!\n";
+    return saved;
+}
+
+void MatchHistoryManager::loadMatchHistoryFromFile(const string &filename) {
+    INSTRUMENT_FILE_SCOPE("MatchHistoryManager::loadMatchHistoryFromFile");
+    syncFile(filename);
+    ifstream inFile(filename);
+    if (!inFile) {
+        cout << "No existing history file found. Starting fresh.\n";
+        return;
+    }
+
+    string line;
+    while (getline(inFile, line)) {
+        stringstream ss(line);
+        MatchHistory mh;
+        
+        getline(ss, mh.historyID, ',');
+        getline(ss, mh.matchID, ',');
+        getline(ss, mh.stageID, ',');
+        getline(ss, mh.p1ID, ',');
+        getline(ss, mh.p2ID, ',');
+        getline(ss, mh.score, ',');
+        
+        // The rest of the line might contain commas within date strings
+        string restOfLine;
+        getline(ss, restOfLine);
+        
+        // Find the last comma
+        size_t lastCommaPos = restOfLine.find_last_of(',');
+        if (lastCommaPos != string::npos) {
+            mh.matchTime = parseMatchTime(restOfLine.substr(0, lastCommaPos));
+            mh.matchDuration = restOfLine.substr(lastCommaPos + 1);
+        } else {
+            mh.matchTime = parseMatchTime(restOfLine);
+            mh.matchDuration = "00:00";
+        }
+        
+        history.push(mh);
+        
+        // Update counters based on loaded data
+        int historyNum = stoi(mh.historyID.substr(1));
+        int matchNum = stoi(mh.matchID.substr(1));
+        
+        historyCounter = max(historyCounter, historyNum + 1);
+        matchCounter = max(matchCounter, matchNum + 1);
+    }
+
+    inFile.close();
+    cout << "Loaded " << history.size() << " match history records.\n";
+}
+
+void MatchHistoryManager::restoreFromState(const TournamentState& state) {
+    // The restored results are held in memory, as the replayed state already is
+    streaming = false;
+    while (!history.isEmpty()) history.pop();
+    historyCounter = 1;
+    ratings.clear();
+    winRates.clear();
+    for (const ResultRecordedEvent& result : state.results) {
+        MatchHistory mh;
+        mh.historyID = generateHistoryID();
+        mh.matchID = result.matchID;
+        mh.stageID = result.stageID;
+        mh.p1ID = result.p1ID;
+        mh.p2ID = result.p2ID;
+        mh.score = to_string(result.score1) + "-" + to_string(result.score2);
+        mh.matchTime = result.matchTime;
+        mh.matchDuration = result.duration;
+        history.push(mh);
+
+        string winner = (result.score1 > result.score2) ? result.p1ID : result.p2ID;
+        ratings.applyResult(result.p1ID, result.p2ID, result.score1, result.score2);
+        winRates.recordResult(result.p1ID, result.p2ID, winner);
+    }
+}
+
+void MatchHistoryManager::displayHistory() {
+    if (streaming) {
+        displayStreamedHistory();
+        return;
+    }
+    if (history.isEmpty()) {
+        cout << "No match history available.\n";
+        return;
+    }
+
+    cout << "\n--- Match History ---\n";
+    cout << left
+        << setw(10) << "HistoryID" 
+        << setw(10) << "MatchID" 
+        << setw(10) << "StageID" 
+        << setw(12) << "Player1" 
+        << setw(12) << "Player2" 
+        << setw(10) << "Score" 
+        << setw(26) << "Match Time" 
+        << "Duration\n";
+    cout << string(95, '-') << endl;
+    
+    // Create a temporary stack to avoid destroying the original
+    MatchHistoryStack tempStack;
+    MatchHistoryStack backupStack;
+    
+    while (!history.isEmpty()) {
+        MatchHistory mh = history.pop();
+        tempStack.push(mh);
+        backupStack.push(mh);
+    }
+    
+    // Restore original stack
+    while (!backupStack.isEmpty()) {
+        history.push(backupStack.pop());
+    }
+    
+    // Display from temp stack
+    while (!tempStack.isEmpty()) {
+        MatchHistory mh = tempStack.pop();
+        cout << left
+            << setw(10) << mh.historyID 
+            << setw(10) << mh.matchID 
+            << setw(10) << mh.stageID 
+            << setw(12) << mh.p1ID 
+            << setw(12) << mh.p2ID 
+            << setw(10) << mh.score 
+            << setw(26) << formatMatchTime(mh.matchTime) 
+            << mh.matchDuration << endl;
+    }
+}
+
+void MatchHistoryManager::displayStreamedHistory() {
+    cout << "\n--- Match History ---\n";
+    cout << left
+        << setw(10) << "HistoryID" 
+        << setw(10) << "MatchID" 
+        << setw(10) << "StageID" 
+        << setw(12) << "Player1" 
+        << setw(12) << "Player2" 
+        << setw(10) << "Score" 
+        << setw(26) << "Match Time" 
+        << "Duration\n";
+    cout << string(95, '-') << endl;
+    long long rows = scanHistoryFile("MatchHistory.txt", [](const HistoryRowView& row) {
+        cout << left
+            << setw(10) << row.historyID 
+            << setw(10) << row.matchID 
+            << setw(10) << row.stageID 
+            << setw(12) << row.p1ID 
+            << setw(12) << row.p2ID 
+            << setw(10) << row.score 
+            << setw(26) << formatMatchTime(parseMatchTime(string(row.matchTime))) 
+            << row.duration << "\n";
+        return true;
+    });
+    if (rows <= 0) cout << "No match history available.\n";
+}
+
+void MatchHistoryManager::searchMatchesByPlayer() {
+    string playerID;
+    cout << "Enter Player ID to search for: ";
+    cin >> playerID;
+
+    bool found = false;
+    cout << "\nMatches for Player " << playerID << ":\n";
+    cout << string(80, '-') << endl;
+    long long rows = scanHistoryFile("MatchHistory.txt", [&](const HistoryRowView& row) {
+        if (row.p1ID == playerID || row.p2ID == playerID) {
+            printSearchRow(row, true);
+            found = true;
+        }
+        return true;
+    }, true);
+    if (rows < 0) cout << "No match history file found." << endl;
+
+    if (!found) {
+        cout << "No matches found for Player ID: " << playerID << endl;
+    }
+}
+
+void MatchHistoryManager::searchMatchesByStage() {
+    string stageID;
+    cout << "Enter Stage ID to search for (e.g., S001): ";
+    cin >> stageID;
+
+    bool found = false;
+    cout << "\nMatches in Stage " << stageID << ":\n";
+    cout << string(80, '-') << endl;
+    long long rows = scanHistoryFile("MatchHistory.txt", [&](const HistoryRowView& row) {
+        if (row.stageID == stageID) {
+            printSearchRow(row, false);
+            found = true;
+        }
+        return true;
+    }, true);
+    if (rows < 0) cout << "No match history file found." << endl;
+
+    if (!found) {
+        cout << "No matches found for Stage ID: " << stageID << endl;
+    }
+}
+
+void MatchHistoryManager::viewRatings() {
+    int topCount;
+    cout << "How many players to show: ";
+    cin >> topCount;
+    if (cin.fail() || topCount < 1) {
+        cin.clear();
+        cin.ignore(numeric_limits<streamsize>::max(), '\n');
+        topCount = 10;
+    }
+    ratings.display(topCount);
+
+    string playerID;
+    cout << "Enter Player ID to look up (or '-' to skip): ";
+    cin >> playerID;
+    if (playerID != "-") {
+        int rank = ratings.getRank(playerID);
+        if (rank == 0) {
+            cout << "Player " << playerID << " has no rated matches." << endl;
+        } else {
+            cout << "Player " << playerID << " is ranked " << rank << " with rating "
+                << formatDecimal(ratings.getRating(playerID), 1) << endl;
+        }
+    }
+}
+
+void MatchHistoryManager::generateStatsReport() {
+    cout << "\n--- Match Statistics Report ---\n";
+    
+    // Count the file's rows in one pass, so the latest data is used without loading it
+    int totalMatches = 0;
+    map<string, int> stageMatches;
+    long long rows = scanHistoryFile("MatchHistory.txt", [&](const HistoryRowView& row) {
+        totalMatches++;
+        stageMatches[string(row.stageID)]++;
+        return true;
+    });
+    if (rows < 0) cout << "No match history file found." << endl;
+    
+    // Display statistics
+    cout << "Total matches recorded: " << totalMatches << endl << endl;
+    
+    cout << "Matches by stage:" << endl;
+    for (auto& pair : stageMatches) {
+        cout << "Stage " << pair.first << ": " << pair.second << " matches" << endl;
+    }
+    cout << endl;
+    
+    // Players in win rate order from the incrementally maintained leaderboard
+    cout << "Player statistics:" << endl;
+    winRates.display(1, winRates.size());
+}
+
+void MatchHistoryManager::viewWinRates() {
+    int fromRank, toRank;
+    cout << "Enter rank range to show (from to): ";
+    cin >> fromRank >> toRank;
+    if (cin.fail() || fromRank < 1 || toRank < fromRank) {
+        cin.clear();
+        cin.ignore(numeric_limits<streamsize>::max(), '\n');
+        fromRank = 1;
+        toRank = 50;
+    }
+    cout << "\n--- Win Rate Leaderboard ---" << endl;
+    winRates.display(fromRank, toRank);
+
+    string playerID;
+    cout << "Enter Player ID to look up (or '-' to skip): ";
+    cin >> playerID;
+    if (playerID != "-") {
+        int rank = winRates.getRank(playerID);
+        if (rank == 0) {
+            cout << "Player " << playerID << " has no recorded matches." << endl;
+        } else {
+            cout << "Player " << playerID << " is ranked " << rank << " of " << winRates.size() << endl;
+        }
+    }
+}
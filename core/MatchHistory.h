@@ -0,0 +1,207 @@
+#ifndef CORE_MATCH_HISTORY_H
+#define CORE_MATCH_HISTORY_H
+
+#include "Scheduling.h"
+#include "HistoryScan.h"
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------
+ * ------------------------------------------ Match History Tracking ----------------------------------------------
+ * ----------------------------------------------------------------------------------------------------------------
+ * A history file larger than HISTORY_STREAMING_THRESHOLD is not loaded into memory: the manager runs in
+ * streaming mode, where listings and searches scan the file (see HistoryScan.h) and new results are appended.
+ * Startup is then a single pass that also folds the rows into the ratings and win rates, so memory grows
+ * with the number of players rather than the number of recorded matches.
+ * Searches and the statistics report always scan the file.
+ *
+ * Environment: TOURNAMENT_HISTORY_STREAMING=on|off|auto (default auto, by file size).
+ */
+
+const long long HISTORY_STREAMING_THRESHOLD = 64LL << 20;     // Bytes of MatchHistory.txt kept in memory at most
+
+// Match structure aligned with database schema
+struct MatchScores {
+    string matchID;
+    string stageID;
+    string roundID;
+    string p1ID;
+    string p2ID;
+    int score1;
+    int score2;
+    string winner;
+    MatchTime scheduledTime;
+    string matchStatus; // "waiting", "ongoing", "completed"
+    string courtID;
+    MatchTime matchTime;  // Match time when recorded
+    string matchDuration; // Duration in minutes:seconds
+
+    MatchScores() {} // Default constructor
+
+    MatchScores(string id, string stage, string round, string player1, string player2, string court, MatchTime scheduled);
+};
+
+// Match History structure to store in the custom stack
+struct MatchHistory {
+    string historyID;
+    string matchID;
+    string stageID;
+    string p1ID;
+    string p2ID;
+    string score;
+    MatchTime matchTime;
+    string matchDuration;
+};
+
+// Custom Stack Implementation for MatchHistory
+class MatchHistoryStack {
+    private:
+        struct Node {
+            MatchHistory data;
+            Node* next;
+            
+            Node(MatchHistory mh) : data(mh), next(nullptr) {}
+        };
+        
+        Node* topNode;
+        int stackSize;
+    
+    public:
+        MatchHistoryStack() : topNode(nullptr), stackSize(0) {}
+        
+        ~MatchHistoryStack();
+        
+        void push(MatchHistory mh);
+        
+        MatchHistory pop();
+        
+        MatchHistory peek();
+        
+        bool isEmpty();
+        
+        int size();
+        
+        // Additional method to iterate through stack without popping elements
+        void forEach(void (*func)(MatchHistory&));
+};
+
+// Class to manage match history
+class MatchHistoryManager {
+    private:
+        MatchHistoryStack history;      // Empty in streaming mode
+        bool streaming;                 // The history stays in MatchHistory.txt
+        long long streamedCount;        // Rows in the file in streaming mode
+        int matchCounter;
+        int historyCounter;
+        map<string, int> playerWins;
+        KnockoutBracket bracket;
+        RatingEngine ratings;
+        WinRateBoard winRates;
+
+        // Helper function to format duration string
+        string formatDuration(int minutes, int seconds);
+        
+        // Convert MatchScores to MatchHistory for storage
+        MatchHistory createHistoryFromMatch(MatchScores& match);
+
+        // Helper function to update Matches.txt
+        void updateMatchesFile(MatchScores& updatedMatch);
+
+        /**
+         * Find a scheduled match in Matches.txt
+         * @param matchID the match ID
+         * @param match Output: the stage, round, players, time, status and court of the match
+         * @return True if the match is scheduled, else False
+         */
+        bool findScheduledMatch(const string& matchID, MatchScores& match);
+
+        // Check if a history file should be streamed rather than loaded
+        static bool shouldStream(const string& filename);
+
+        // Number of an ID such as H001 or M00012, 0 if it has none
+        static int idNumber(string_view id);
+
+        /**
+         * Start from a streamed history file in one pass: continue its IDs and rebuild the ratings and
+         * win rates, keeping only per-player state in memory
+         * @param filename the match history file
+         */
+        void scanStreamedHistory(const string& filename);
+
+        // Keep a new history entry: appended to the file when streaming, else pushed and the file saved
+        void commitHistoryEntry(const MatchHistory& mh);
+
+        // Print one history row of a search result
+        static void printSearchRow(const HistoryRowView& row, bool withStage);
+
+    public:
+        MatchHistoryManager();
+
+        // Generate a new match ID
+        string generateMatchID();
+
+        // Generate a unique history ID
+        string generateHistoryID();
+
+        // Record match results with minimal user input
+        void recordMatch();
+
+        /**
+         * Record a match result (the work of recordMatch after its prompts)
+         * The stage, players and court are taken from the match in Matches.txt.
+         * @param matchID the match ID
+         * @param score1 the first player's score
+         * @param score2 the second player's score
+         * @param duration the match duration (MM:SS)
+         * @param recorded Output: the history entry added
+         * @return True if the result was recorded, False if the match is not scheduled or the scores are level
+         */
+        bool recordResult(const string& matchID, int score1, int score2, const string& duration, MatchHistory& recorded);
+
+        const RatingEngine& getRatings() const { return ratings; }
+        const WinRateBoard& getWinRates() const { return winRates; }
+
+        // Update match status - Fixed version
+        void updateMatchStatus();
+
+        // Simulate match play
+        void simulateMatch(MatchScores& match);
+
+        // Save match to Matches.txt file (appended by the background writer, after any pending rewrite)
+        WriteHandle saveMatchToFile(MatchScores& match);
+
+        // Save match history to file (written by the background writer); returns the handle of the write
+        WriteHandle saveMatchHistoryToFile(const string &filename);
+
+        // Load match history from file
+        void loadMatchHistoryFromFile(const string &filename);
+
+        /**
+         * Replace the history, ratings and win rates with the results of a state rebuilt from the event log
+         * History IDs are numbered again in the order the results were recorded.
+         * @param state the replayed state
+         */
+        void restoreFromState(const TournamentState& state);
+
+        // Display all match history
+        void displayHistory();
+
+        // Display the history file a row at a time, oldest first
+        void displayStreamedHistory();
+
+        // Search matches for a specific player, newest first (one pass over the file)
+        void searchMatchesByPlayer();
+        
+        // Search matches by stage, newest first (one pass over the file)
+        void searchMatchesByStage();
+        
+        // Display the rating leaderboard and look up a player's rank
+        void viewRatings();
+
+        // Generate statistics report - Fixed version
+        void generateStatsReport();
+
+        // Display a range of the win rate leaderboard and look up a player's rank
+        void viewWinRates();
+};
+
+#endif
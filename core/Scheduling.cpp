@@ -0,0 +1,2108 @@
+#include "Scheduling.h"
+
+/**
+ * Phase of a match for ordering: stage first, then round
+ * @param stageID the stage ID e.g. S002
+ * @param roundID the round ID e.g. R003
+ */
+int getMatchPhase(const string& stageID, const string& roundID) {
+    int stage = 0, round = 0;
+    if (stageID.size() > 1) stage = atoi(stageID.c_str() + 1);
+    if (roundID.size() > 1) round = atoi(roundID.c_str() + 1);
+    return stage * 1000 + round;
+}
+
+/**
+ * Function to read player names as keys (Name -> ID)
+ * @param filename the name of the file
+ */
+map<string, string> readPlayersByName(const string& filename) {
+    INSTRUMENT_FILE_SCOPE("readPlayersByName");
+    syncFile(filename);
+    ifstream file(filename);
+    map<string, string> players;
+    if (!file) return players;
+
+    string line;
+    while (getline(file, line)) {
+        stringstream ss(line);
+        string playerId, name;
+        getline(ss, playerId, ',');
+        getline(ss, name, ',');
+        players[name] = playerId;  // Name as key, ID as value
+    }
+    file.close();
+    return players;
+}
+
+/**
+ * Function to read player IDs as keys (ID -> Name)
+ * @param filename the name of the file
+ */
+map<string, string> readPlayersByID(const string& filename) {
+    INSTRUMENT_FILE_SCOPE("readPlayersByID");
+    syncFile(filename);
+    ifstream file(filename);
+    map<string, string> players;
+    if (!file) return players;
+
+    string line;
+    while (getline(file, line)) {
+        stringstream ss(line);
+        string playerId, name;
+        getline(ss, playerId, ',');
+        getline(ss, name, ',');
+        players[playerId] = name;  // ID as key, Name as value
+    }
+    file.close();
+    return players;
+}
+
+/**
+ * Function to read matches from file
+ * The rows are appended to a vector reserved from the file size, so loading is one linear pass.
+ * @param filename the name of the file
+ * @param matches Output: the matches in file order
+ */
+void readMatches(const string& filename, vector<matchHistory>& matches) {
+    INSTRUMENT_FILE_SCOPE("readMatches");
+    struct stat info;
+    if (stat(filename.c_str(), &info) == 0) matches.reserve(matches.size() + info.st_size / HISTORY_ROW_BYTES + 1);
+
+    long long rows = scanHistoryFile(filename, [&matches](const HistoryRowView& row) {
+        matchHistory match;
+        match.matchId = row.matchID;
+        match.stage = row.stageID;
+        match.p1Id = row.p1ID;
+        match.p2Id = row.p2ID;
+        match.setScores = row.score;
+        match.matchedTime = row.matchTime;
+        match.duration = row.duration;
+        matches.push_back(move(match));
+        return true;
+    });
+    if (rows < 0) cerr << "Error opening file!" << endl;
+}
+
+/** ---- Match IDs ---- */
+
+MatchIdSource& MatchIdSource::instance() {
+    static MatchIdSource source;
+    return source;
+}
+
+int MatchIdSource::numberOf(const string& matchID) {
+    if (matchID.size() < 2 || matchID[0] != 'M') return 0;
+    return atoi(matchID.c_str() + 1);
+}
+
+string MatchIdSource::format(int number) {
+    stringstream ss;
+    ss << "M" << setw(3) << setfill('0') << number;
+    return ss.str();
+}
+
+string MatchIdSource::next() {
+    lock_guard<mutex> guard(lock);
+    if (!seeded) {
+        // Continue after the highest ID in the file, whichever component loads it first
+        seeded = true;
+        syncFile("Matches.txt");
+        ifstream file("Matches.txt");
+        string line;
+        while (getline(file, line)) {
+            lastNumber = max(lastNumber, numberOf(line.substr(0, line.find(','))));
+        }
+    }
+    return format(++lastNumber);
+}
+
+void MatchIdSource::observe(const string& matchID) {
+    lock_guard<mutex> guard(lock);
+    lastNumber = max(lastNumber, numberOf(matchID));
+}
+
+void MatchIdSource::recordAppended(const Matches& match) {
+    lock_guard<mutex> guard(lock);
+    lastNumber = max(lastNumber, numberOf(match.matchID));
+    appended.push_back(match);
+}
+
+size_t MatchIdSource::appendedCount() {
+    lock_guard<mutex> guard(lock);
+    return appended.size();
+}
+
+vector<Matches> MatchIdSource::appendedSince(size_t index) {
+    lock_guard<mutex> guard(lock);
+    if (index >= appended.size()) return {};
+    return vector<Matches>(appended.begin() + index, appended.end());
+}
+
+/** ---- ScheduleOptimizer ---- */
+
+bool ScheduleOptimizer::isRested(const vector<int>& busy, int slot) {
+    for (int other : busy) {
+        if (other / SLOTS_PER_DAY == slot / SLOTS_PER_DAY && abs(other - slot) < MIN_REST_SLOTS) return false;
+    }
+    return true;
+}
+
+int ScheduleOptimizer::placeGreedy(const vector<int>& order, vector<int>& slots, vector<int>& courtIndexes) const {
+    vector<int> usage; // usage[slot * courtsCount + court]
+    unordered_map<string, vector<int>> busy;
+    auto use = [&](int slot, int court) {
+        size_t cell = (size_t)slot * courtsCount + court;
+        if (usage.size() <= cell) usage.resize((slot + 16) * courtsCount, 0);
+        usage[cell]++;
+    };
+    auto freeCourt = [&](int slot) {
+        for (int c = 0; c < courtsCount; c++) {
+            size_t cell = (size_t)slot * courtsCount + c;
+            int used = cell < usage.size() ? usage[cell] : 0;
+            if (used < courts[c].maxConcurrentMatches) return c;
+        }
+        return -1;
+    };
+
+    int makespan = firstSlot;
+    for (const Placement& match : fixed) {
+        if (match.slot >= 0) {
+            use(match.slot, match.courtIndex);
+            makespan = max(makespan, match.slot + 1);
+        }
+        busy[match.p1ID].push_back(match.slot);
+        busy[match.p2ID].push_back(match.slot);
+    }
+
+    // Phase barriers: a phase starts after every earlier phase has finished
+    int floor = firstSlot;
+    int currentPhase = -1;
+    int lastSlotSoFar = -1;
+    auto fixedIt = fixedPhaseLastSlot.begin();
+    for (int index : order) {
+        const Placement& match = batch[index];
+        if (match.phase != currentPhase) {
+            while (fixedIt != fixedPhaseLastSlot.end() && fixedIt -> first < match.phase) {
+                lastSlotSoFar = max(lastSlotSoFar, fixedIt -> second);
+                ++fixedIt;
+            }
+            floor = max(floor, lastSlotSoFar + 1);
+            currentPhase = match.phase;
+        }
+        const vector<int>& busy1 = busy[match.p1ID];
+        const vector<int>& busy2 = busy[match.p2ID];
+        int slot = floor;
+        int court = -1;
+        // Ends: some court takes a match (checked by optimize) and a player rests in all but finitely many slots
+        while (true) {
+            if (isRested(busy1, slot) && isRested(busy2, slot)) {
+                court = freeCourt(slot);
+                if (court != -1) break;
+            }
+            slot++;
+        }
+        use(slot, court);
+        busy[match.p1ID].push_back(slot);
+        busy[match.p2ID].push_back(slot);
+        slots[index] = slot;
+        courtIndexes[index] = court;
+        makespan = max(makespan, slot + 1);
+        // Later phases wait for this one
+        if (slot > lastSlotSoFar) lastSlotSoFar = slot;
+    }
+    return makespan;
+}
+
+ScheduleOptimizer::ScheduleOptimizer(const Courts* courtList, int count, MatchTime replanFrom)
+    : courts(courtList), courtsCount(count) {
+    gridStart = replanFrom - replanFrom % 1440;
+    int minuteOfDay = replanFrom % 1440;
+    int hour = (minuteOfDay + 59) / 60; // Round up to the next full hour
+    firstSlot = min(max(hour - DAY_FIRST_HOUR, 0), SLOTS_PER_DAY);
+}
+
+MatchTime ScheduleOptimizer::slotToTime(int slot) const {
+    return gridStart + (slot / SLOTS_PER_DAY) * 1440 + (DAY_FIRST_HOUR + slot % SLOTS_PER_DAY) * 60;
+}
+
+int ScheduleOptimizer::timeToSlot(MatchTime time) const {
+    if (time < gridStart) return -1;
+    int day = (time - gridStart) / 1440;
+    int minuteOfDay = (time - gridStart) % 1440;
+    if (minuteOfDay % 60 != 0) return -1;
+    int hour = minuteOfDay / 60 - DAY_FIRST_HOUR;
+    if (hour < 0 || hour >= SLOTS_PER_DAY) return -1;
+    return day * SLOTS_PER_DAY + hour;
+}
+
+void ScheduleOptimizer::addFixed(const string& p1ID, const string& p2ID, MatchTime time, int courtIndex, int phase) {
+    int slot = timeToSlot(time);
+    if (slot < 0 || courtIndex < 0) {
+        return;
+    }
+    fixed.push_back({p1ID, p2ID, phase, slot, courtIndex});
+    int& last = fixedPhaseLastSlot[phase];
+    last = max(last, slot);
+}
+
+int ScheduleOptimizer::addMatch(const string& p1ID, const string& p2ID, int phase) {
+    batch.push_back({p1ID, p2ID, phase, -1, -1});
+    return batch.size() - 1;
+}
+
+int ScheduleOptimizer::optimize(int budgetMs) {
+    int slotCapacity = 0;
+    for (int c = 0; c < courtsCount; c++) slotCapacity += max(courts[c].maxConcurrentMatches, 0);
+    if (batch.empty() || slotCapacity == 0) return 0;
+    auto deadline = chrono::steady_clock::now() + chrono::milliseconds(budgetMs);
+
+    // Most loaded players first inside each phase
+    unordered_map<string, int> load;
+    for (const Placement& match : batch) {
+        load[match.p1ID]++;
+        load[match.p2ID]++;
+    }
+    vector<int> order(batch.size());
+    for (size_t i = 0; i < order.size(); i++) order[i] = i;
+    stable_sort(order.begin(), order.end(), [&](int a, int b) {
+        if (batch[a].phase != batch[b].phase) return batch[a].phase < batch[b].phase;
+        return load[batch[a].p1ID] + load[batch[a].p2ID] > load[batch[b].p1ID] + load[batch[b].p2ID];
+    });
+
+    // Lower bound: each phase needs at least ceil(matches / slot capacity) slots
+    map<int, int> phaseSizes;
+    for (const Placement& match : batch) phaseSizes[match.phase]++;
+    int lowerBound = firstSlot;
+    for (const auto& phase : phaseSizes) {
+        lowerBound += (phase.second + slotCapacity - 1) / slotCapacity;
+    }
+
+    vector<int> slots(batch.size()), courtIndexes(batch.size());
+    int best = placeGreedy(order, slots, courtIndexes);
+    for (size_t i = 0; i < batch.size(); i++) {
+        batch[i].slot = slots[i];
+        batch[i].courtIndex = courtIndexes[i];
+    }
+
+    int attempts = 1;
+    mt19937 rng(12345);
+    while (best > lowerBound && chrono::steady_clock::now() < deadline) {
+        // Shuffle the order inside each phase and place again
+        size_t begin = 0;
+        while (begin < order.size()) {
+            size_t end = begin;
+            while (end < order.size() && batch[order[end]].phase == batch[order[begin]].phase) end++;
+            shuffle(order.begin() + begin, order.begin() + end, rng);
+            begin = end;
+        }
+        int makespan = placeGreedy(order, slots, courtIndexes);
+        attempts++;
+        if (makespan < best) {
+            best = makespan;
+            for (size_t i = 0; i < batch.size(); i++) {
+                batch[i].slot = slots[i];
+                batch[i].courtIndex = courtIndexes[i];
+            }
+        }
+    }
+    return attempts;
+}
+
+MatchTime ScheduleOptimizer::getLastStart() const {
+    int last = firstSlot;
+    for (const Placement& match : batch) last = max(last, match.slot);
+    return slotToTime(last);
+}
+
+/** ---- GroupStandings ---- */
+
+void GroupStandings::applyResult(const string& line) {
+    stringstream ss(line);
+    string historyID, matchID, stageID, p1ID, p2ID, score;
+    getline(ss, historyID, ',');
+    getline(ss, matchID, ',');
+    getline(ss, stageID, ',');
+    getline(ss, p1ID, ',');
+    getline(ss, p2ID, ',');
+    getline(ss, score, ',');
+    if (stageID != "S002") return;
+
+    auto g1 = playerGroup.find(p1ID);
+    auto g2 = playerGroup.find(p2ID);
+    if (g1 == playerGroup.end() || g2 == playerGroup.end() || g1 -> second != g2 -> second) return;
+
+    int score1 = 0, score2 = 0;
+    char dash;
+    stringstream scoreSS(score);
+    if (!(scoreSS >> score1 >> dash >> score2)) return;
+    // Level scores have no winner (recordResult refuses them), so an old row like that is not counted
+    if (score1 == score2) return;
+
+    map<string, GroupStanding>& table = groups[g1 -> second];
+    GroupStanding& s1 = table[p1ID];
+    GroupStanding& s2 = table[p2ID];
+    s1.played++;
+    s2.played++;
+    s1.pointsFor += score1;
+    s1.pointsAgainst += score2;
+    s2.pointsFor += score2;
+    s2.pointsAgainst += score1;
+    if (score1 > score2) {
+        s1.wins++;
+        s2.losses++;
+    } else {
+        s2.wins++;
+        s1.losses++;
+    }
+}
+
+void GroupStandings::resetTables() {
+    groups.clear();
+    for (const auto& member : playerGroup) {
+        groups[member.second][member.first] = GroupStanding{member.first, 0, 0, 0, 0, 0};
+    }
+    consumed = 0;
+}
+
+GroupStandings::GroupStandings(const string& groupsFilename, const string& historyFilename)
+    : groupsFile(groupsFilename), historyFile(historyFilename), consumed(0) {
+    loadGroups();
+}
+
+void GroupStandings::loadGroups() {
+    INSTRUMENT_FILE_SCOPE("GroupStandings::loadGroups");
+    playerGroup.clear();
+    ifstream file(groupsFile);
+    string line;
+    while (getline(file, line)) {
+        stringstream ss(line);
+        string group, playerID;
+        getline(ss, group, ',');
+        getline(ss, playerID, ',');
+        if (!group.empty() && !playerID.empty()) {
+            playerGroup[playerID] = group;
+        }
+    }
+    resetTables();
+}
+
+void GroupStandings::setGroups(const vector<vector<string>>& members) {
+    INSTRUMENT_FILE_SCOPE("GroupStandings::setGroups");
+    ofstream file(groupsFile);
+    playerGroup.clear();
+    for (size_t g = 0; g < members.size(); g++) {
+        stringstream name;
+        name << "G" << setw(2) << setfill('0') << (g + 1);
+        for (const string& playerID : members[g]) {
+            playerGroup[playerID] = name.str();
+            file << name.str() << "," << playerID << "\n";
+        }
+    }
+    file.close();
+    resetTables();
+}
+
+void GroupStandings::refresh() {
+    INSTRUMENT_FILE_SCOPE("GroupStandings::refresh");
+    syncFile(historyFile);
+    ifstream file(historyFile, ios::binary);
+    if (!file) return;
+    file.seekg(0, ios::end);
+    streamoff size = file.tellg();
+    // The history was rewritten shorter, apply it again from the start
+    if (size < consumed) {
+        resetTables();
+    }
+    file.seekg(consumed);
+    string line;
+    while (getline(file, line)) {
+        // Leave a partly written last line for the next refresh
+        if (file.eof()) break;
+        consumed = file.tellg();
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        if (!line.empty()) applyResult(line);
+    }
+}
+
+vector<GroupStanding> GroupStandings::getTable(const string& group) {
+    vector<GroupStanding> table;
+    auto it = groups.find(group);
+    if (it == groups.end()) return table;
+    for (const auto& row : it -> second) table.push_back(row.second);
+    sort(table.begin(), table.end(), [](const GroupStanding& a, const GroupStanding& b) {
+        if (a.wins != b.wins) return a.wins > b.wins;
+        int diffA = a.pointsFor - a.pointsAgainst, diffB = b.pointsFor - b.pointsAgainst;
+        if (diffA != diffB) return diffA > diffB;
+        return a.playerID < b.playerID;
+    });
+    return table;
+}
+
+vector<string> GroupStandings::getGroupNames() const {
+    vector<string> names;
+    for (const auto& group : groups) names.push_back(group.first);
+    return names;
+}
+
+void GroupStandings::display() {
+    refresh();
+    if (groups.empty()) {
+        cout << "No round robin groups generated yet." << endl;
+        return;
+    }
+    for (const string& group : getGroupNames()) {
+        cout << "\n--- Group " << group << " ---" << endl;
+        cout << left << setw(12) << "Player ID" << setw(8) << "Played" << setw(6) << "Wins"
+                << setw(8) << "Losses" << "Diff" << endl;
+        for (const GroupStanding& row : getTable(group)) {
+            cout << left << setw(12) << row.playerID << setw(8) << row.played << setw(6) << row.wins
+                    << setw(8) << row.losses << (row.pointsFor - row.pointsAgainst) << endl;
+        }
+    }
+}
+
+/** ---- KnockoutBracket ---- */
+
+int KnockoutBracket::roundOf(int node) const {
+    int depth = 0, totalDepth = 0;
+    for (int i = node + 1; i > 1; i /= 2) depth++;
+    for (int i = leafCount; i > 1; i /= 2) totalDepth++;
+    return totalDepth - depth;
+}
+
+MatchTime KnockoutBracket::nextFreeTime(MatchTime ready) const {
+    MatchTime time = ready + (60 - ready % 60) % 60;
+    while (true) {
+        int hour = (time % 1440) / 60;
+        if (hour < DAY_FIRST_HOUR) {
+            time = time - time % 1440 + DAY_FIRST_HOUR * 60;
+        } else if (hour >= DAY_FIRST_HOUR + SLOTS_PER_DAY) {
+            time = time - time % 1440 + 1440 + DAY_FIRST_HOUR * 60;
+        }
+        if (usedTimes.find(time) == usedTimes.end()) return time;
+        time += 60;
+    }
+}
+
+MatchTime KnockoutBracket::readScheduledMatches() {
+    MatchTime lastEarlierStart = TIME_TBD;
+    int knockoutPhase = getMatchPhase("S003", "");
+    syncFile("Matches.txt");
+    ifstream matchFile("Matches.txt");
+    string line;
+    while (getline(matchFile, line)) {
+        stringstream ss(line);
+        string matchID, stageID, roundID, p1ID, p2ID, scheduledTime, status, courtID;
+        getline(ss, matchID, ',');
+        getline(ss, stageID, ',');
+        getline(ss, roundID, ',');
+        getline(ss, p1ID, ',');
+        getline(ss, p2ID, ',');
+        getline(ss, scheduledTime, ',');
+        getline(ss, status, ',');
+        getline(ss, courtID);
+        if (!courtID.empty() && courtID.back() == '\r') courtID.pop_back();
+        MatchTime time = parseMatchTime(scheduledTime);
+        if (time < 0) continue;
+        if (courtID == KNOCKOUT_COURT) usedTimes.insert(time);
+        if (getMatchPhase(stageID, "") < knockoutPhase) lastEarlierStart = max(lastEarlierStart, time);
+    }
+    MatchTime gridStart = tournamentStart() + DAY_FIRST_HOUR * 60;
+    return lastEarlierStart == TIME_TBD ? gridStart : max(gridStart, lastEarlierStart + MIN_REST_SLOTS * 60);
+}
+
+void KnockoutBracket::scheduleNodeMatch(int node) {
+    INSTRUMENT_FILE_SCOPE("KnockoutBracket::scheduleNodeMatch");
+    MatchTime ready = readScheduledMatches();
+    for (int child : {2 * node + 1, 2 * node + 2}) {
+        if (!nodes[child].matchID.empty() && nodes[child].time >= 0) {
+            ready = max(ready, nodes[child].time + MIN_REST_SLOTS * 60);
+        }
+    }
+    string matchID = MatchIdSource::instance().next();
+    assignMatch(node, matchID, nextFreeTime(ready));
+
+    Matches match;
+    match.matchID = matchID;
+    match.stageID = "S003";
+    match.roundID = getRoundID(node);
+    match.p1ID = nodes[2 * node + 1].playerID;
+    match.p2ID = nodes[2 * node + 2].playerID;
+    match.scheduledTime = nodes[node].time;
+    match.matchStatus = "waiting";
+    match.courtID = KNOCKOUT_COURT;
+    AsyncFileWriter::instance().append("Matches.txt", matchID + ",S003," + match.roundID + "," + match.p1ID + ","
+                                       + match.p2ID + "," + formatMatchTime(match.scheduledTime) + ",waiting,"
+                                       + KNOCKOUT_COURT + "\n");
+    // Recorded after the append is queued, so a scheduler loading Matches.txt meanwhile sees the row
+    MatchIdSource::instance().recordAppended(match);
+    EventLog::instance().append(MatchScheduledEvent{matchID, "S003", getRoundID(node), nodes[2 * node + 1].playerID,
+                                                    nodes[2 * node + 2].playerID, nodes[node].time, "waiting", KNOCKOUT_COURT});
+    cout << "Knockout match " << matchID << " scheduled: " << nodes[2 * node + 1].playerID
+            << " vs " << nodes[2 * node + 2].playerID << " at " << formatMatchTime(nodes[node].time) << "\n";
+}
+
+bool KnockoutBracket::load() {
+    INSTRUMENT_FILE_SCOPE("KnockoutBracket::load");
+    nodes.clear();
+    matchNodes.clear();
+    usedTimes.clear();
+    leafCount = 0;
+    rememberFileState();
+    ifstream file(filename);
+    if (!file || !(file >> leafCount) || leafCount < 1) {
+        leafCount = 0;
+        return false;
+    }
+    nodes.assign(2 * leafCount - 1, BracketNode{"", "", TIME_TBD});
+    string line;
+    getline(file, line);
+    while (getline(file, line)) {
+        stringstream ss(line);
+        string index, playerID, matchID, time;
+        getline(ss, index, ',');
+        getline(ss, playerID, ',');
+        getline(ss, matchID, ',');
+        getline(ss, time, ',');
+        int node = atoi(index.c_str());
+        if (index.empty() || node < 0 || node >= (int)nodes.size()) continue;
+        nodes[node].playerID = playerID;
+        nodes[node].matchID = matchID;
+        nodes[node].time = time.empty() ? TIME_TBD : atoi(time.c_str());
+        if (!matchID.empty()) {
+            matchNodes[matchID] = node;
+            if (nodes[node].time >= 0) usedTimes.insert(nodes[node].time);
+        }
+    }
+    return true;
+}
+
+void KnockoutBracket::save() const {
+    INSTRUMENT_FILE_SCOPE("KnockoutBracket::save");
+    ofstream file(filename);
+    if (!file) {
+        cout << "Error: Unable to save " << filename << ".\n";
+        return;
+    }
+    file << leafCount << "\n";
+    for (size_t i = 0; i < nodes.size(); i++) {
+        const BracketNode& node = nodes[i];
+        if (node.playerID.empty() && node.matchID.empty()) continue;
+        file << i << "," << node.playerID << "," << node.matchID << "," << node.time << "\n";
+    }
+    file.close();
+    rememberFileState();
+}
+
+void KnockoutBracket::rememberFileState() const {
+    struct stat info;
+    if (stat(filename.c_str(), &info) != 0) {
+        fileSize = -1;
+        fileModified = -1;
+        return;
+    }
+    fileSize = info.st_size;
+#if defined(__linux__)
+    fileModified = (long long)info.st_mtim.tv_sec * 1000000000LL + info.st_mtim.tv_nsec;
+#else
+    fileModified = (long long)info.st_mtime * 1000000000LL;
+#endif
+}
+
+bool KnockoutBracket::refresh() {
+    long long size = fileSize, modified = fileModified;
+    rememberFileState();
+    if (size == fileSize && modified == fileModified) {
+        return false;
+    }
+    load();
+    return true;
+}
+
+void KnockoutBracket::build(const vector<string>& seededPlayers) {
+    leafCount = 1;
+    while (leafCount < (int)seededPlayers.size()) leafCount *= 2;
+    nodes.assign(2 * leafCount - 1, BracketNode{"", "", TIME_TBD});
+    matchNodes.clear();
+    usedTimes.clear();
+
+    // Standard seed order: [1,2] -> [1,4,2,3] -> [1,8,4,5,2,7,3,6] ...
+    vector<int> order(1, 1);
+    while ((int)order.size() < leafCount) {
+        int size = order.size() * 2;
+        vector<int> next;
+        for (int seed : order) {
+            next.push_back(seed);
+            next.push_back(size + 1 - seed);
+        }
+        order = next;
+    }
+    for (int i = 0; i < leafCount; i++) {
+        int seed = order[i];
+        nodes[leafCount - 1 + i].playerID = seed <= (int)seededPlayers.size() ? seededPlayers[seed - 1] : BRACKET_BYE;
+    }
+
+    // Players facing a bye advance without a match
+    for (int node = leafCount - 2; node >= 0; node--) {
+        const string& left = nodes[2 * node + 1].playerID;
+        const string& right = nodes[2 * node + 2].playerID;
+        if (left == BRACKET_BYE && !right.empty()) nodes[node].playerID = right;
+        else if (right == BRACKET_BYE && !left.empty()) nodes[node].playerID = left;
+    }
+}
+
+vector<int> KnockoutBracket::getReadyMatches() const {
+    vector<int> ready;
+    for (int node = leafCount - 2; node >= 0; node--) {
+        const string& left = nodes[2 * node + 1].playerID;
+        const string& right = nodes[2 * node + 2].playerID;
+        if (nodes[node].playerID.empty() && nodes[node].matchID.empty() &&
+            !left.empty() && !right.empty() && left != BRACKET_BYE && right != BRACKET_BYE) {
+            ready.push_back(node);
+        }
+    }
+    return ready;
+}
+
+void KnockoutBracket::assignMatch(int node, const string& matchID, MatchTime time) {
+    nodes[node].matchID = matchID;
+    nodes[node].time = time;
+    matchNodes[matchID] = node;
+    if (time >= 0) usedTimes.insert(time);
+}
+
+string KnockoutBracket::getRoundID(int node) const {
+    stringstream ss;
+    ss << "R" << setw(3) << setfill('0') << roundOf(node);
+    return ss.str();
+}
+
+int KnockoutBracket::findMatch(const string& matchID) const {
+    auto it = matchNodes.find(matchID);
+    return it == matchNodes.end() ? -1 : it -> second;
+}
+
+bool KnockoutBracket::reportResult(const string& matchID, const string& winnerID) {
+    int node = findMatch(matchID);
+    if (node == -1 || !nodes[node].playerID.empty()) {
+        return false;
+    }
+    if (winnerID != getPlayer1(node) && winnerID != getPlayer2(node)) {
+        cout << "Winner " << winnerID << " is not a player of knockout match " << matchID << ".\n";
+        return false;
+    }
+    nodes[node].playerID = winnerID;
+
+    while (node > 0) {
+        int parent = parentOf(node);
+        const string& other = nodes[siblingOf(node)].playerID;
+        if (other.empty()) break; // Waiting for the other half of the bracket
+        if (other == BRACKET_BYE) {
+            nodes[parent].playerID = nodes[node].playerID;
+            node = parent;
+            continue;
+        }
+        scheduleNodeMatch(parent);
+        break;
+    }
+    if (node == 0 && !nodes[0].playerID.empty()) {
+        cout << "Tournament champion: " << nodes[0].playerID << "\n";
+    }
+    save();
+    return true;
+}
+
+void KnockoutBracket::display() const {
+    if (leafCount < 2) {
+        cout << "No knockout bracket generated yet." << endl;
+        return;
+    }
+    cout << "\n--- Knockout Bracket ---" << endl;
+    for (int first = leafCount / 2 - 1; first >= 0; first = (first - 1) / 2) {
+        cout << "Round " << getRoundID(first) << ":" << endl;
+        for (int node = first; node <= 2 * first; node++) {
+            cout << "  " << left << setw(6) << (nodes[node].matchID.empty() ? "-" : nodes[node].matchID)
+                    << setw(12) << (getPlayer1(node).empty() ? "TBD" : getPlayer1(node)) << "vs "
+                    << setw(12) << (getPlayer2(node).empty() ? "TBD" : getPlayer2(node))
+                    << "Winner: " << (nodes[node].playerID.empty() ? "-" : nodes[node].playerID) << endl;
+        }
+        if (first == 0) break;
+    }
+}
+
+/** ---- RatingEngine ---- */
+
+void RatingEngine::applyElo(unordered_map<string, double>& table, const RatedResult& result) {
+    auto r1 = table.emplace(result.p1ID, DEFAULT_RATING).first;
+    auto r2 = table.emplace(result.p2ID, DEFAULT_RATING).first;
+    double expected1 = 1.0 / (1.0 + pow(10.0, (r2 -> second - r1 -> second) / 400.0));
+    double actual1 = result.score1 > result.score2 ? 1.0 : 0.0;
+    double change = ELO_K_FACTOR * (actual1 - expected1);
+    r1 -> second += change;
+    r2 -> second -= change;
+}
+
+void RatingEngine::rebuildLeaderboard() {
+    leaderboard.clear();
+    for (const auto& rating : ratings) {
+        leaderboard.insert(RatingKey(rating.second, rating.first));
+    }
+}
+
+void RatingEngine::applyResult(const string& p1ID, const string& p2ID, int score1, int score2) {
+    for (const string& playerID : {p1ID, p2ID}) {
+        auto it = ratings.find(playerID);
+        if (it != ratings.end()) leaderboard.erase(RatingKey(it -> second, playerID));
+    }
+    applyElo(ratings, RatedResult{p1ID, p2ID, score1, score2});
+    leaderboard.insert(RatingKey(ratings[p1ID], p1ID));
+    leaderboard.insert(RatingKey(ratings[p2ID], p2ID));
+}
+
+bool RatingEngine::applyHistoryRow(const HistoryRowView& row) {
+    int score1, score2;
+    if (row.p1ID.empty() || !parseHistoryScore(row.score, score1, score2)) return false;
+    applyElo(ratings, RatedResult{string(row.p1ID), string(row.p2ID), score1, score2});
+    return true;
+}
+
+int RatingEngine::recomputeFromHistory(const string& filename) {
+    INSTRUMENT_FILE_SCOPE("RatingEngine::recomputeFromHistory");
+    clear();
+    int count = 0;
+    scanHistoryFile(filename, [&](const HistoryRowView& row) {
+        if (applyHistoryRow(row)) count++;
+        return true;
+    });
+    finishRecompute();
+    return count;
+}
+
+void RatingEngine::clear() {
+    ratings.clear();
+    leaderboard.clear();
+}
+
+double RatingEngine::getRating(const string& playerID) const {
+    auto it = ratings.find(playerID);
+    return it == ratings.end() ? DEFAULT_RATING : it -> second;
+}
+
+int RatingEngine::getRank(const string& playerID) const {
+    auto it = ratings.find(playerID);
+    if (it == ratings.end()) return 0;
+    return leaderboard.rankOf(RatingKey(it -> second, playerID)) + 1;
+}
+
+vector<RatingKey> RatingEngine::getRange(int fromRank, int toRank) const {
+    vector<RatingKey> entries;
+    for (int rank = max(fromRank, 1); rank <= toRank && rank <= leaderboard.size(); rank++) {
+        entries.push_back(leaderboard.kth(rank - 1));
+    }
+    return entries;
+}
+
+void RatingEngine::display(int topCount) const {
+    if (ratings.empty()) {
+        cout << "No rated matches yet." << endl;
+        return;
+    }
+    cout << "\n--- Rating Leaderboard ---" << endl;
+    cout << left << setw(6) << "Rank" << setw(12) << "Player ID" << "Rating" << endl;
+    int rank = 1;
+    for (const RatingKey& entry : getRange(1, topCount)) {
+        cout << left << setw(6) << rank++ << setw(12) << entry.second
+                << formatDecimal(entry.first, 1) << endl;
+    }
+}
+
+/** ---- WinRateBoard ---- */
+
+void WinRateBoard::addMatch(const string& playerID, bool won) {
+    auto inserted = records.emplace(playerID, WinRateKey{0, 0, playerID});
+    WinRateKey& record = inserted.first -> second;
+    if (!inserted.second) leaderboard.erase(record);
+    record.played++;
+    if (won) record.wins++;
+    leaderboard.insert(record);
+}
+
+void WinRateBoard::recordResult(const string& p1ID, const string& p2ID, const string& winnerID) {
+    addMatch(p1ID, winnerID == p1ID);
+    addMatch(p2ID, winnerID == p2ID);
+}
+
+bool WinRateBoard::applyHistoryRow(const HistoryRowView& row) {
+    int score1, score2;
+    if (row.p1ID.empty() || !parseHistoryScore(row.score, score1, score2)) return false;
+    string p1ID(row.p1ID), p2ID(row.p2ID);
+    recordResult(p1ID, p2ID, score1 > score2 ? p1ID : p2ID);
+    return true;
+}
+
+int WinRateBoard::loadFromHistory(const string& filename) {
+    INSTRUMENT_FILE_SCOPE("WinRateBoard::loadFromHistory");
+    clear();
+    int count = 0;
+    scanHistoryFile(filename, [&](const HistoryRowView& row) {
+        if (applyHistoryRow(row)) count++;
+        return true;
+    });
+    return count;
+}
+
+void WinRateBoard::clear() {
+    records.clear();
+    leaderboard.clear();
+}
+
+int WinRateBoard::getRank(const string& playerID) const {
+    auto it = records.find(playerID);
+    if (it == records.end()) return 0;
+    return leaderboard.rankOf(it -> second) + 1;
+}
+
+vector<WinRateKey> WinRateBoard::getRange(int fromRank, int toRank) const {
+    vector<WinRateKey> entries;
+    for (int rank = max(fromRank, 1); rank <= toRank && rank <= leaderboard.size(); rank++) {
+        entries.push_back(leaderboard.kth(rank - 1));
+    }
+    return entries;
+}
+
+void WinRateBoard::display(int fromRank, int toRank) const {
+    if (records.empty()) {
+        cout << "No recorded matches yet." << endl;
+        return;
+    }
+    cout << left << setw(6) << "Rank" << setw(12) << "Player ID" << setw(12) << "Matches"
+            << setw(12) << "Wins" << "Win Rate" << endl;
+    cout << string(50, '-') << endl;
+    int rank = max(fromRank, 1);
+    for (const WinRateKey& entry : getRange(fromRank, toRank)) {
+        cout << left << setw(6) << rank++ << setw(12) << entry.playerID << setw(12) << entry.played
+                << setw(12) << entry.wins << formatDecimal((double)entry.wins / entry.played * 100.0, 1)
+                << "%" << endl;
+    }
+}
+
+/** ---- TournamentScheduler ---- */
+
+void TournamentScheduler::initializeSchedules() {
+    courtSchedules.assign(max(courtsCount, 0), queue<TimeSlot>());
+    
+    // Court i plays on day i of the tournament (the first three days for the three stage courts)
+    for (int courtIndex = 0; courtIndex < courtsCount; courtIndex++) {
+        MatchTime date = tournamentStart() + courtIndex * 1440;
+        string courtID = courts[courtIndex].courtID;
+        
+        for (int hour = 7; hour < 19; hour++) {
+            TimeSlot slot;
+            slot.startTime = date + hour * 60;
+            slot.courtID = courtID;
+            slot.concurrentCount = 0;
+            
+            courtSchedules[courtIndex].push(slot);
+        }
+    }
+}
+
+void TournamentScheduler::resizeMatchesArray() {
+    int newCapacity = matchesCapacity == 0 ? 10 : matchesCapacity * 2;
+    Matches* newMatches = new Matches[newCapacity];
+    
+    for (int i = 0; i < matchesCount; ++i) {
+        newMatches[i] = matches[i];
+    }
+    
+    delete[] matches;
+    matches = newMatches;
+    matchesCapacity = newCapacity;
+}
+
+void TournamentScheduler::resizePlayersArray() {
+    int newCapacity = playersCapacity == 0 ? 50 : playersCapacity * 2;
+    Players* newPlayers = new Players[newCapacity];
+    
+    for (int i = 0; i < playersCount; ++i) {
+        newPlayers[i] = players[i];
+    }
+    
+    delete[] players;
+    players = newPlayers;
+    playersCapacity = newCapacity;
+}
+
+void TournamentScheduler::validatePlayerID(const string& playerID) {
+    if (playerID.empty()) {
+        throw ValidationException("Player ID cannot be empty");
+    }
+    if (!regex_match(playerID, regex("^APUTCP\\d{3}$"))) {
+        throw ValidationException("Invalid Player ID format. Must be APUTCP followed by 3 digits");
+    }
+}
+
+void TournamentScheduler::validateStageID(const string& stageID) {
+    const string validStages[] = {"S001", "S002", "S003"};
+    bool valid = false;
+    for (const auto& stage : validStages) {
+        if (stageID == stage) {
+            valid = true;
+            break;
+        }
+    }
+    if (!valid) {
+        throw ValidationException("Invalid Stage ID. Must be S001, S002, or S003");
+    }
+}
+
+void TournamentScheduler::loadPlayers() {
+    INSTRUMENT_FILE_SCOPE("TournamentScheduler::loadPlayers");
+    syncFile("Players.txt");
+    ifstream playerFile("Players.txt");
+    if (!playerFile) {
+        throw ValidationException("Cannot open Players.txt");
+    }
+
+    playersCount = 0;
+    playersCapacity = 50;
+    players = new Players[playersCapacity];
+
+    string line;
+    while (getline(playerFile, line)) {
+        if (playersCount >= playersCapacity) {
+            resizePlayersArray();
+        }
+
+        istringstream iss(line);
+        Players& player = players[playersCount];
+        
+        getline(iss, player.playerID, ',');
+        getline(iss, player.name, ',');
+        getline(iss, player.nationality, ',');
+        
+        string temp;
+        getline(iss, temp, ',');
+        player.ranking = stoi(temp);
+        
+        getline(iss, temp, ',');
+        player.gender = temp[0];
+        
+        getline(iss, player.stageID);
+
+        playersCount++;
+    }
+    playerFile.close();
+}
+
+void TournamentScheduler::loadMatches() {
+    INSTRUMENT_FILE_SCOPE("TournamentScheduler::loadMatches");
+    // Read before the file: a match appended meanwhile is then in the file, the later merge skips it
+    appendedSeen = MatchIdSource::instance().appendedCount();
+    syncFile("Matches.txt");
+    ifstream matchFile("Matches.txt");
+    if (!matchFile) {
+        ofstream createFile("Matches.txt");
+        createFile.close();
+        
+        matchesCount = 0;
+        matchesCapacity = 10;
+        matches = new Matches[matchesCapacity];
+        
+        initializeSchedules();
+        
+        return;
+    }
+
+    matchesCount = 0;
+    matchesCapacity = 10;
+    matches = new Matches[matchesCapacity];
+
+    string line;
+    while (getline(matchFile, line)) {
+        if (matchesCount >= matchesCapacity) {
+            resizeMatchesArray();
+        }
+
+        istringstream iss(line);
+        Matches& match = matches[matchesCount];
+        
+        getline(iss, match.matchID, ',');
+        getline(iss, match.stageID, ',');
+        getline(iss, match.roundID, ',');
+        getline(iss, match.p1ID, ',');
+        getline(iss, match.p2ID, ',');
+        string scheduledTime;
+        getline(iss, scheduledTime, ',');
+        match.scheduledTime = parseMatchTime(scheduledTime);
+        getline(iss, match.matchStatus, ',');
+        getline(iss, match.courtID);
+        MatchIdSource::instance().observe(match.matchID);
+
+        matchesCount++;
+    }
+    matchFile.close();
+    
+    initializeSchedules();
+    updateSchedulesFromMatches();
+}
+
+void TournamentScheduler::updateSchedulesFromMatches() {
+    for (int i = 0; i < matchesCount; i++) {
+        bookMatchSlot(matches[i]);
+    }
+}
+
+void TournamentScheduler::bookMatchSlot(const Matches& match) {
+    if (match.scheduledTime < 0) {
+        return;
+    }
+    
+    int courtIndex = getCourtIndexFromID(match.courtID);
+    if (courtIndex == -1) return;
+    
+    // A court/day pair the queue does not model yet (an optimizer placement) gets its slot added in time order
+    queue<TimeSlot> tempQueue;
+    bool booked = false;
+    while (!courtSchedules[courtIndex].empty()) {
+        TimeSlot slot = courtSchedules[courtIndex].front();
+        courtSchedules[courtIndex].pop();
+        
+        if (!booked && slot.startTime > match.scheduledTime) {
+            tempQueue.push(TimeSlot{match.scheduledTime, courts[courtIndex].courtID, 1});
+            booked = true;
+        }
+        if (slot.startTime == match.scheduledTime) {
+            slot.concurrentCount++;
+            booked = true;
+        }
+        
+        tempQueue.push(slot);
+    }
+    if (!booked) {
+        tempQueue.push(TimeSlot{match.scheduledTime, courts[courtIndex].courtID, 1});
+    }
+    
+    courtSchedules[courtIndex] = tempQueue;
+}
+
+int TournamentScheduler::getCourtIndexFromID(const string& courtID) {
+    for (int i = 0; i < courtsCount; i++) {
+        if (courts[i].courtID == courtID) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+int TournamentScheduler::getCourtIndexFromStage(const string& stageID) {
+    if (stageID == "S001") return 0;  // C001
+    if (stageID == "S002") return 1;  // C002
+    if (stageID == "S003") return 2;  // C003
+    return -1;
+}
+
+MatchTime TournamentScheduler::getNextAvailableTimeSlot(const string& stageID) {
+    INSTRUMENT_SCOPE("getNextAvailableTimeSlot");
+    int courtIndex = getCourtIndexFromStage(stageID);
+    if (courtIndex == -1) {
+        return TIME_TBD;
+    }
+    
+    int maxConcurrent = courts[courtIndex].maxConcurrentMatches;
+    queue<TimeSlot> tempQueue;
+    MatchTime availableTime = TIME_TBD;
+    
+    while (!courtSchedules[courtIndex].empty()) {
+        TimeSlot slot = courtSchedules[courtIndex].front();
+        courtSchedules[courtIndex].pop();
+        
+        if (slot.concurrentCount < maxConcurrent) {
+            slot.concurrentCount++;
+            availableTime = slot.startTime;
+            tempQueue.push(slot);
+            
+            while (!courtSchedules[courtIndex].empty()) {
+                tempQueue.push(courtSchedules[courtIndex].front());
+                courtSchedules[courtIndex].pop();
+            }
+            
+            courtSchedules[courtIndex] = tempQueue;
+            return availableTime;
+        }
+        
+        tempQueue.push(slot);
+    }
+    
+    courtSchedules[courtIndex] = tempQueue;
+    return TIME_TBD;
+}
+
+string TournamentScheduler::generateMatchID() {
+    return MatchIdSource::instance().next();
+}
+
+void TournamentScheduler::mergeAppendedMatches() {
+    vector<Matches> appended = MatchIdSource::instance().appendedSince(appendedSeen);
+    if (appended.empty()) return;
+    appendedSeen += appended.size();
+    unordered_set<string> known;
+    for (int i = 0; i < matchesCount; ++i) known.insert(matches[i].matchID);
+    for (const Matches& match : appended) {
+        if (known.count(match.matchID)) continue;
+        if (matchesCount >= matchesCapacity) resizeMatchesArray();
+        matches[matchesCount++] = match;
+        bookMatchSlot(match);
+    }
+}
+
+unordered_set<string> TournamentScheduler::getBookedPlayers() {
+    unordered_set<string> booked;
+    booked.reserve(matchesCount * 2);
+    for (int i = 0; i < matchesCount; ++i) {
+        booked.insert(matches[i].p1ID);
+        booked.insert(matches[i].p2ID);
+    }
+    return booked;
+}
+
+void TournamentScheduler::sortBySeed(vector<int>& seeds) {
+    RatingEngine ratings;
+    ratings.recomputeFromHistory("MatchHistory.txt");
+    bool useRatings = ratings.hasRatings();
+    sort(seeds.begin(), seeds.end(), [&](int a, int b) {
+        if (useRatings) {
+            double ratingA = ratings.getRating(players[a].playerID);
+            double ratingB = ratings.getRating(players[b].playerID);
+            if (ratingA != ratingB) return ratingA > ratingB;
+        }
+        if (players[a].ranking != players[b].ranking) return players[a].ranking < players[b].ranking;
+        return players[a].playerID < players[b].playerID;
+    });
+}
+
+MatchTime TournamentScheduler::getStageStart(const string& stageID) const {
+    int phase = getMatchPhase(stageID, "");
+    MatchTime lastStart = TIME_TBD;
+    for (int i = 0; i < matchesCount; ++i) {
+        if (matches[i].scheduledTime >= 0 && getMatchPhase(matches[i].stageID, "") < phase) {
+            lastStart = max(lastStart, matches[i].scheduledTime);
+        }
+    }
+    return lastStart == TIME_TBD ? TIME_TBD : lastStart + MIN_REST_SLOTS * 60;
+}
+
+vector<MatchTime> TournamentScheduler::takeTimeSlots(const string& stageID, int count, MatchTime notBefore) {
+    vector<MatchTime> times;
+    times.reserve(count);
+    int courtIndex = getCourtIndexFromStage(stageID);
+    if (courtIndex != -1 && courts[courtIndex].maxConcurrentMatches > 0) {
+        int maxConcurrent = courts[courtIndex].maxConcurrentMatches;
+        queue<TimeSlot> tempQueue;
+        MatchTime lastStart = TIME_TBD;
+        while (!courtSchedules[courtIndex].empty()) {
+            TimeSlot slot = courtSchedules[courtIndex].front();
+            courtSchedules[courtIndex].pop();
+            while (slot.startTime >= notBefore && slot.concurrentCount < maxConcurrent && (int)times.size() < count) {
+                slot.concurrentCount++;
+                times.push_back(slot.startTime);
+            }
+            lastStart = max(lastStart, slot.startTime);
+            tempQueue.push(slot);
+        }
+
+        // Further hourly slots after the last one modelled, on the grid's hours
+        MatchTime time = max(lastStart == TIME_TBD ? tournamentStart() + DAY_FIRST_HOUR * 60 : lastStart + 60, notBefore);
+        time += (60 - time % 60) % 60;
+        while ((int)times.size() < count) {
+            int hour = (time % 1440) / 60;
+            if (hour < DAY_FIRST_HOUR) {
+                time = time - time % 1440 + DAY_FIRST_HOUR * 60;
+            } else if (hour >= DAY_FIRST_HOUR + SLOTS_PER_DAY) {
+                time = time - time % 1440 + 1440 + DAY_FIRST_HOUR * 60;
+            }
+            TimeSlot slot{time, courts[courtIndex].courtID, 0};
+            while (slot.concurrentCount < maxConcurrent && (int)times.size() < count) {
+                slot.concurrentCount++;
+                times.push_back(slot.startTime);
+            }
+            tempQueue.push(slot);
+            time += 60;
+        }
+        courtSchedules[courtIndex] = tempQueue;
+    }
+    while ((int)times.size() < count) {
+        times.push_back(TIME_TBD);
+    }
+    return times;
+}
+
+int TournamentScheduler::generateStageDraw(const string& stageID, unordered_set<string>& booked) {
+    vector<int> seeds;
+    for (int i = 0; i < playersCount; ++i) {
+        if (players[i].stageID == stageID && booked.find(players[i].playerID) == booked.end()) {
+            seeds.push_back(i);
+        }
+    }
+    sortBySeed(seeds);
+
+    int pairs = seeds.size() / 2;
+    bool hasBye = seeds.size() % 2 == 1;
+    if (pairs == 0 && !hasBye) {
+        return 0;
+    }
+
+    while (matchesCount + pairs + (hasBye ? 1 : 0) > matchesCapacity) {
+        resizeMatchesArray();
+    }
+    string courtID = courts[getCourtIndexFromStage(stageID)].courtID;
+    vector<MatchTime> times = takeTimeSlots(stageID, pairs, getStageStart(stageID));
+
+    for (int i = 0; i < pairs; ++i) {
+        const Players& higherSeed = players[seeds[i]];
+        const Players& lowerSeed = players[seeds[seeds.size() - 1 - i]];
+        Matches& newMatch = matches[matchesCount];
+        newMatch.matchID = generateMatchID();
+        newMatch.stageID = stageID;
+        newMatch.roundID = "R001";
+        newMatch.p1ID = higherSeed.playerID;
+        newMatch.p2ID = lowerSeed.playerID;
+        newMatch.scheduledTime = times[i];
+        newMatch.matchStatus = "waiting";
+        newMatch.courtID = courtID;
+        matchesCount++;
+        booked.insert(higherSeed.playerID);
+        booked.insert(lowerSeed.playerID);
+    }
+
+    // The middle seed sits the round out: the bye is saved as a row of its own, so advanceStage
+    // lets its holder through and later draws see the player as booked
+    if (hasBye) {
+        const Players& byeHolder = players[seeds[pairs]];
+        Matches& bye = matches[matchesCount];
+        bye.matchID = generateMatchID();
+        bye.stageID = stageID;
+        bye.roundID = "R001";
+        bye.p1ID = byeHolder.playerID;
+        bye.p2ID = BRACKET_BYE;
+        bye.scheduledTime = TIME_TBD;
+        bye.matchStatus = DRAW_BYE_STATUS;
+        bye.courtID = courtID;
+        matchesCount++;
+        booked.insert(byeHolder.playerID);
+        cout << "Stage " << stageID << ": " << byeHolder.playerID << " receives a bye." << endl;
+    }
+    return pairs;
+}
+
+WriteHandle TournamentScheduler::saveMatchesToFile() {
+    INSTRUMENT_FILE_SCOPE("TournamentScheduler::saveMatchesToFile");
+    mergeAppendedMatches();
+    string contents;
+    contents.reserve(matchesCount * 64);
+    for (int i = 0; i < matchesCount; ++i) {
+        contents += matches[i].matchID + "," + matches[i].stageID + "," + matches[i].roundID + ","
+                    + matches[i].p1ID + "," + matches[i].p2ID + "," + formatMatchTime(matches[i].scheduledTime) + ","
+                    + matches[i].matchStatus + "," + matches[i].courtID + "\n";
+    }
+    WriteHandle saved = AsyncFileWriter::instance().rewrite("Matches.txt", move(contents));
+
+    // Log the rows that differ from the event log's state
+    EventLog& eventLog = EventLog::instance();
+    if (!eventLog.isEnabled()) return saved;
+    vector<EventPayload> changes;
+    for (int i = 0; i < matchesCount; ++i) {
+        MatchScheduledEvent row{matches[i].matchID, matches[i].stageID, matches[i].roundID, matches[i].p1ID,
+                                matches[i].p2ID, matches[i].scheduledTime, matches[i].matchStatus, matches[i].courtID};
+        if (!eventLog.isRecorded(row)) changes.push_back(move(row));
+    }
+    eventLog.append(changes);
+    return saved;
+}
+
+void TournamentScheduler::placeNewMatches(int firstIndex, int budgetMs) {
+    ScheduleOptimizer optimizer(courts, courtsCount, tournamentStart());
+    for (int i = 0; i < firstIndex; ++i) {
+        if (matches[i].scheduledTime >= 0) {
+            optimizer.addFixed(matches[i].p1ID, matches[i].p2ID, matches[i].scheduledTime,
+                               getCourtIndexFromID(matches[i].courtID),
+                               getMatchPhase(matches[i].stageID, matches[i].roundID));
+        }
+    }
+    for (int i = firstIndex; i < matchesCount; ++i) {
+        optimizer.addMatch(matches[i].p1ID, matches[i].p2ID, getMatchPhase(matches[i].stageID, matches[i].roundID));
+    }
+    if (optimizer.optimize(budgetMs) == 0) {
+        // No court takes a match: the new matches stay TBD
+        for (int i = firstIndex; i < matchesCount; ++i) matches[i].scheduledTime = TIME_TBD;
+        return;
+    }
+    for (int i = firstIndex; i < matchesCount; ++i) {
+        matches[i].scheduledTime = optimizer.getTime(i - firstIndex);
+        matches[i].courtID = courts[optimizer.getCourtIndex(i - firstIndex)].courtID;
+    }
+    initializeSchedules();
+    updateSchedulesFromMatches();
+}
+
+int TournamentScheduler::generateKnockoutMatches(unordered_set<string>& booked) {
+    vector<int> seeds;
+    for (int i = 0; i < playersCount; ++i) {
+        if (players[i].stageID == "S003" && booked.find(players[i].playerID) == booked.end()) {
+            seeds.push_back(i);
+        }
+    }
+    if (seeds.size() < 2) {
+        return 0;
+    }
+    sortBySeed(seeds);
+    vector<string> seededPlayers;
+    for (int index : seeds) seededPlayers.push_back(players[index].playerID);
+
+    KnockoutBracket bracket;
+    bracket.build(seededPlayers);
+    vector<int> ready = bracket.getReadyMatches();
+    // The knockout starts once every earlier stage has finished
+    vector<MatchTime> times = takeTimeSlots("S003", ready.size(), getStageStart("S003"));
+    for (size_t i = 0; i < ready.size(); ++i) {
+        if (matchesCount >= matchesCapacity) {
+            resizeMatchesArray();
+        }
+        int node = ready[i];
+        Matches& newMatch = matches[matchesCount];
+        newMatch.matchID = generateMatchID();
+        newMatch.stageID = "S003";
+        newMatch.roundID = bracket.getRoundID(node);
+        newMatch.p1ID = bracket.getPlayer1(node);
+        newMatch.p2ID = bracket.getPlayer2(node);
+        newMatch.scheduledTime = times[i];
+        newMatch.matchStatus = "waiting";
+        newMatch.courtID = KNOCKOUT_COURT;
+        matchesCount++;
+        bracket.assignMatch(node, newMatch.matchID, times[i]);
+    }
+    for (const string& playerID : seededPlayers) booked.insert(playerID);
+    bracket.save();
+    return ready.size();
+}
+
+int TournamentScheduler::generateRoundRobinMatches(int groupSize, unordered_set<string>& booked) {
+    vector<int> seeds;
+    for (int i = 0; i < playersCount; ++i) {
+        if (players[i].stageID == "S002" && booked.find(players[i].playerID) == booked.end()) {
+            seeds.push_back(i);
+        }
+    }
+    if (seeds.size() < 2 || groupSize < 2) {
+        return 0;
+    }
+    sortBySeed(seeds);
+
+    // Snake seeding: 1..G, G..1, 1..G, ...
+    int groupCount = (seeds.size() + groupSize - 1) / groupSize;
+    vector<vector<string>> groupMembers(groupCount);
+    for (size_t i = 0; i < seeds.size(); ++i) {
+        int pass = i / groupCount;
+        int offset = i % groupCount;
+        int group = (pass % 2 == 0) ? offset : groupCount - 1 - offset;
+        groupMembers[group].push_back(players[seeds[i]].playerID);
+    }
+    standings.setGroups(groupMembers);
+
+    int added = 0;
+    for (const vector<string>& members : groupMembers) {
+        // Circle method: the first player stays, the others rotate; "" is a bye
+        vector<string> circle = members;
+        if (circle.size() % 2 == 1) circle.push_back("");
+        int n = circle.size();
+        for (int round = 0; round < n - 1; ++round) {
+            stringstream roundID;
+            roundID << "R" << setw(3) << setfill('0') << (round + 1);
+            for (int i = 0; i < n / 2; ++i) {
+                const string& p1 = circle[i];
+                const string& p2 = circle[n - 1 - i];
+                if (p1.empty() || p2.empty()) continue;
+                if (matchesCount >= matchesCapacity) {
+                    resizeMatchesArray();
+                }
+                Matches& newMatch = matches[matchesCount];
+                newMatch.matchID = generateMatchID();
+                newMatch.stageID = "S002";
+                newMatch.roundID = roundID.str();
+                newMatch.p1ID = p1;
+                newMatch.p2ID = p2;
+                newMatch.scheduledTime = TIME_TBD;
+                newMatch.matchStatus = "waiting";
+                newMatch.courtID = courts[getCourtIndexFromStage("S002")].courtID;
+                matchesCount++;
+                added++;
+            }
+            rotate(circle.begin() + 1, circle.end() - 1, circle.end());
+        }
+        for (const string& playerID : members) booked.insert(playerID);
+    }
+    return added;
+}
+
+TournamentScheduler::TournamentScheduler() {
+    // Initialize court data from file instead of hardcoding
+    courts = nullptr;
+    courtsCount = 0;
+    if (!loadCourtsFromFile(courts, courtsCount)) {
+        // Fallback to hardcoded values if file operations fail
+        courts = new Courts[3]{
+            {"C001", "Center", 1500, 2},
+            {"C002", "Championship", 1000, 1},
+            {"C003", "Progression", 750, 1}
+        };
+        courtsCount = 3;
+        cout << "Using default hardcoded court values." << endl;
+    }
+
+    matches = nullptr;
+    matchesCount = 0;
+    matchesCapacity = 0;
+
+    players = nullptr;
+    playersCount = 0;
+    playersCapacity = 0;
+    
+    appendedSeen = 0;
+
+    try {
+        loadPlayers();
+        loadMatches();
+    } catch (const exception& e) {
+        cerr << "Error loading data: " << e.what() << endl;
+        playersCount = 0;
+        playersCapacity = 10;
+        players = new Players[playersCapacity];
+        
+        matchesCount = 0;
+        matchesCapacity = 10;
+        matches = new Matches[matchesCapacity];
+        
+        initializeSchedules();
+    }
+}
+
+TournamentScheduler::~TournamentScheduler() {
+    delete[] courts;
+    delete[] matches;
+    delete[] players;
+}
+
+bool TournamentScheduler::createCourtFile() {
+    INSTRUMENT_FILE_SCOPE("TournamentScheduler::createCourtFile");
+    ofstream courtFile("Court.txt");
+    if (!courtFile) {
+        cerr << "Error: Could not create Court.txt file." << endl;
+        return false;
+    }
+    
+    // Write default court data
+    courtFile << "C001,Center,1500,2\n"
+              << "C002,Championship,1000,1\n"
+              << "C003,Progression,750,1\n";
+    
+    courtFile.close();
+    LOG_EVENT(LOG_INFO, "courts.created", "Court.txt file created successfully with default values.\n");
+    return true;
+}
+
+bool TournamentScheduler::loadCourtsFromFile(Courts* &courts, int &courtsCount) {
+    INSTRUMENT_FILE_SCOPE("TournamentScheduler::loadCourtsFromFile");
+    ifstream courtFile("Court.txt");
+    if (!courtFile) {
+        LOG_EVENT(LOG_WARN, "courts.missing", "Court.txt not found. Creating default file...\n");
+        if (!createCourtFile()) {
+            return false;
+        }
+        courtFile.open("Court.txt");
+        if (!courtFile) {
+            cerr << "Error: Could not open Court.txt after creation." << endl;
+            return false;
+        }
+    }
+
+    // Count the number of courts in the file
+    int count = 0;
+    string line;
+    while (getline(courtFile, line)) {
+        if (!line.empty()) {
+            count++;
+        }
+    }
+    
+    // Reset file to beginning
+    courtFile.clear();
+    courtFile.seekg(0, ios::beg);
+    
+    // Allocate courts array
+    courts = new Courts[count];
+    courtsCount = count;
+    
+    // Read court data
+    int index = 0;
+    while (getline(courtFile, line)) {
+        if (line.empty()) continue;
+        
+        stringstream ss(line);
+        getline(ss, courts[index].courtID, ',');
+        getline(ss, courts[index].courtType, ',');
+        
+        string capacityStr, maxMatchesStr;
+        getline(ss, capacityStr, ',');
+        getline(ss, maxMatchesStr, ',');
+        
+        courts[index].capacity = stoi(capacityStr);
+        courts[index].maxConcurrentMatches = stoi(maxMatchesStr);
+        
+        index++;
+    }
+    
+    courtFile.close();
+    LOG_EVENT(LOG_INFO, "courts.loaded", "Loaded " << courtsCount << " courts from Court.txt.\n", {"count", to_string(courtsCount)});
+    return true;
+}
+
+bool TournamentScheduler::saveCourtsToFile(Courts* courts, int courtsCount) {
+    INSTRUMENT_FILE_SCOPE("TournamentScheduler::saveCourtsToFile");
+    ofstream courtFile("Court.txt");
+    if (!courtFile) {
+        cerr << "Error: Could not open Court.txt for writing." << endl;
+        return false;
+    }
+    
+    for (int i = 0; i < courtsCount; i++) {
+        courtFile << courts[i].courtID << ","
+                << courts[i].courtType << ","
+                << courts[i].capacity << ","
+                << courts[i].maxConcurrentMatches << "\n";
+    }
+    
+    courtFile.close();
+    LOG_EVENT(LOG_INFO, "courts.saved", "Court data saved to Court.txt.\n", {"count", to_string(courtsCount)});
+    return true;
+}
+
+void TournamentScheduler::displayAvailablePlayers(const string& stageID) {
+    cout << "Available Players in Stage " << stageID << ":" << endl;
+    bool foundPlayers = false;
+
+    for (int i = 0; i < playersCount; ++i) {
+        if (players[i].stageID == stageID) {
+            bool inMatch = false;
+            for (int j = 0; j < matchesCount; ++j) {
+                if (matches[j].p1ID == players[i].playerID || 
+                    matches[j].p2ID == players[i].playerID) {
+                    inMatch = true;
+                    break;
+                }
+            }
+
+            if (!inMatch) {
+                cout << "Player ID: " << players[i].playerID 
+                        << ", Name: " << players[i].name 
+                        << ", Nationality: " << players[i].nationality 
+                        << endl;
+                foundPlayers = true;
+            }
+        }
+    }
+
+    if (!foundPlayers) {
+        cout << "No available players in this stage." << endl;
+    }
+}
+
+bool TournamentScheduler::scheduleMatch(const string& p1ID) {
+    try {
+        validatePlayerID(p1ID);
+        
+        for (int i = 0; i < matchesCount; ++i) {
+            if (matches[i].p1ID == p1ID || matches[i].p2ID == p1ID) {
+                throw ValidationException("Player 1 is already scheduled in a match");
+            }
+        }
+        
+        Players player1;
+        bool player1Found = false;
+        
+        for (int i = 0; i < playersCount; ++i) {
+            if (players[i].playerID == p1ID) {
+                player1 = players[i];
+                player1Found = true;
+                break;
+            }
+        }
+
+        if (!player1Found) {
+            throw ValidationException("Player 1 not found");
+        }
+        string stageID = player1.stageID;
+        cout << "\nAvailable players for match in Stage " << stageID << ":" << endl;
+        int availableCount = 0;
+        vector<string> availablePlayerIDs;
+        for (int i = 0; i < playersCount; ++i) {
+            Players& potentialOpponent = players[i];
+            if (potentialOpponent.playerID == p1ID || potentialOpponent.stageID != stageID) {
+                continue;
+            }
+            bool inMatch = false;
+            for (int j = 0; j < matchesCount; ++j) {
+                if (matches[j].p1ID == potentialOpponent.playerID || 
+                    matches[j].p2ID == potentialOpponent.playerID) {
+                    inMatch = true;
+                    break;
+                }
+            }
+            if (!inMatch) {
+                cout << (availableCount + 1) << ". Player ID: " << potentialOpponent.playerID 
+                        << ", Name: " << potentialOpponent.name 
+                        << ", Nationality: " << potentialOpponent.nationality << endl;
+                availablePlayerIDs.push_back(potentialOpponent.playerID);
+                availableCount++;
+            }
+        }
+
+        if (availableCount == 0) {
+            throw ValidationException("No available opponents in the same stage");
+        }
+
+        string selection;
+        int selectedIndex;
+
+        cout << "\nSelect opponent by number (1-" << availableCount << "): ";
+        cin >> selection;
+
+        try {
+            selectedIndex = stoi(selection) - 1;
+            if (selectedIndex < 0 || selectedIndex >= availableCount) {
+                throw out_of_range("Index out of range");
+            }
+        } catch (const exception&) {
+            throw ValidationException("Invalid selection");
+        }
+
+        string p2ID = availablePlayerIDs[selectedIndex];
+        // Only the work after the opponent prompt is timed
+        INSTRUMENT_SCOPE("scheduleMatch");
+
+        string courtID;
+        if (stageID == "S001") courtID = "C001";
+        else if (stageID == "S002") courtID = "C002";
+        else if (stageID == "S003") courtID = "C003";
+        else throw ValidationException("Invalid stage ID");
+
+        MatchTime scheduledTime = getNextAvailableTimeSlot(stageID);
+
+        if (matchesCount >= matchesCapacity) {
+            resizeMatchesArray();
+        }
+
+        Matches& newMatch = matches[matchesCount];
+        newMatch.matchID = generateMatchID();
+        newMatch.stageID = stageID;
+        newMatch.roundID = "R001";
+        newMatch.p1ID = p1ID;
+        newMatch.p2ID = p2ID;
+        newMatch.scheduledTime = scheduledTime;
+        newMatch.matchStatus = "waiting";
+        newMatch.courtID = courtID;
+        matchesCount++;
+        saveMatchesToFile();
+
+        cout << "Match scheduled successfully!" << endl;
+        cout << "Match details: " << newMatch.matchID << ", " 
+                << newMatch.stageID << ", " 
+                << "Players: " << p1ID << " vs " << p2ID << ", "
+                << "Time: " << (scheduledTime == TIME_TBD ? "TBD - No available slots" : formatMatchTime(scheduledTime)) << ", "
+                << "Court: " << courtID << endl;
+        
+        return true;
+    } catch (const ValidationException& e) {
+        cerr << "Match scheduling error: " << e.what() << endl;
+        return false;
+    }
+}
+
+int TournamentScheduler::scheduleAllStages() {
+    if (courtsCount < 3) {
+        cerr << "Automatic scheduling needs the three stage courts." << endl;
+        return 0;
+    }
+    unordered_set<string> booked = getBookedPlayers();
+    const string stages[] = {"S001", "S002", "S003"};
+    int scheduled = 0;
+    int unplaced = 0;
+    int firstNew = matchesCount;
+
+    for (const string& stageID : stages) {
+        if (stageID == "S002") {
+            // Round robin matches are placed across all courts, one round after another
+            int roundRobinStart = matchesCount;
+            int added = generateRoundRobinMatches(DEFAULT_GROUP_SIZE, booked);
+            if (added > 0) {
+                placeNewMatches(roundRobinStart, 200);
+            }
+            scheduled += added;
+        } else if (stageID == "S003") {
+            scheduled += generateKnockoutMatches(booked);
+        } else {
+            scheduled += generateStageDraw(stageID, booked);
+        }
+    }
+    for (int i = firstNew; i < matchesCount; ++i) {
+        if (matches[i].scheduledTime == TIME_TBD && matches[i].matchStatus != DRAW_BYE_STATUS) unplaced++;
+    }
+
+    // A draw may add only a bye, which is saved as well
+    if (matchesCount > firstNew) {
+        saveMatchesToFile();
+    }
+    cout << scheduled << " matches scheduled";
+    if (unplaced > 0) {
+        cout << " (" << unplaced << " without a free time slot, marked TBD)";
+    }
+    cout << "." << endl;
+    return scheduled;
+}
+
+int TournamentScheduler::scheduleRoundRobin(int groupSize) {
+    unordered_set<string> booked = getBookedPlayers();
+    int firstNew = matchesCount;
+    int added = generateRoundRobinMatches(groupSize, booked);
+    if (added == 0) {
+        cout << "Not enough unbooked players in stage S002 for round robin groups." << endl;
+        return 0;
+    }
+    placeNewMatches(firstNew, 200);
+    saveMatchesToFile();
+    cout << added << " round robin matches scheduled." << endl;
+    return added;
+}
+
+int TournamentScheduler::scheduleKnockout() {
+    unordered_set<string> booked = getBookedPlayers();
+    int added = generateKnockoutMatches(booked);
+    if (added == 0) {
+        cout << "Not enough unbooked players in stage S003 for a knockout bracket." << endl;
+        return 0;
+    }
+    saveMatchesToFile();
+    cout << added << " knockout matches scheduled. Later rounds are scheduled as results are recorded." << endl;
+    return added;
+}
+
+int TournamentScheduler::optimizeSchedule(int budgetMs, MatchTime replanFrom) {
+    ScheduleOptimizer optimizer(courts, courtsCount, replanFrom);
+    vector<int> batchMatches;
+
+    for (int i = 0; i < matchesCount; ++i) {
+        Matches& match = matches[i];
+        int phase = getMatchPhase(match.stageID, match.roundID);
+        bool movable = match.matchStatus == "waiting" &&
+                       (match.scheduledTime == TIME_TBD || match.scheduledTime >= replanFrom);
+        if (movable) {
+            optimizer.addMatch(match.p1ID, match.p2ID, phase);
+            batchMatches.push_back(i);
+        } else if (match.scheduledTime >= 0) {
+            optimizer.addFixed(match.p1ID, match.p2ID, match.scheduledTime,
+                               getCourtIndexFromID(match.courtID), phase);
+        }
+    }
+
+    if (batchMatches.empty()) {
+        cout << "No waiting matches to place." << endl;
+        return 0;
+    }
+
+    int attempts = optimizer.optimize(budgetMs);
+    if (attempts == 0) {
+        cout << "No court takes a match (every court allows 0 concurrent matches); nothing was moved." << endl;
+        return 0;
+    }
+    for (size_t b = 0; b < batchMatches.size(); ++b) {
+        Matches& match = matches[batchMatches[b]];
+        match.scheduledTime = optimizer.getTime(b);
+        match.courtID = courts[optimizer.getCourtIndex(b)].courtID;
+    }
+
+    // Rebuild the per-court slot queues from the new plan
+    initializeSchedules();
+    updateSchedulesFromMatches();
+    saveMatchesToFile();
+
+    cout << batchMatches.size() << " matches placed after " << attempts << " plans. "
+            << "Last match starts " << formatMatchTime(optimizer.getLastStart()) << "." << endl;
+    return batchMatches.size();
+}
+
+bool TournamentScheduler::advancePlayerStage(const string& playerID) {
+    try {
+        validatePlayerID(playerID);
+        
+        int playerIndex = -1;
+        for (int i = 0; i < playersCount; ++i) {
+            if (players[i].playerID == playerID) {
+                playerIndex = i;
+                break;
+            }
+        }
+        
+        if (playerIndex == -1) {
+            throw ValidationException("Player not found");
+        }
+        
+        Players& player = players[playerIndex];
+        
+        if (player.stageID == "S003") {
+            throw ValidationException("Player is already at the highest stage (Knockout)");
+        }
+        
+        bool hasCompletedMatch = false;
+        for (int i = 0; i < matchesCount; ++i) {
+            if ((matches[i].p1ID == playerID || matches[i].p2ID == playerID) && 
+                (matches[i].matchStatus == "completed" || matches[i].matchStatus == DRAW_BYE_STATUS)) {
+                hasCompletedMatch = true;
+                break;
+            }
+        }
+        
+        if (!hasCompletedMatch) {
+            throw ValidationException("Player must complete a match in current stage before advancing");
+        }
+        
+        string currentStage = player.stageID;
+        string nextStage;
+        
+        if (currentStage == "S001") {
+            nextStage = "S002";
+            cout << "Advancing player from Qualifier to Round Robin stage." << endl;
+        } else if (currentStage == "S002") {
+            nextStage = "S003";
+            cout << "Advancing player from Round Robin to Knockout stage." << endl;
+        }
+        
+        player.stageID = nextStage;
+        
+        savePlayersToFile();
+        
+        cout << "Player " << player.name << " (ID: " << playerID << ") "
+                << "has been advanced to stage " << nextStage << endl;
+                
+        return true;
+    } catch (const ValidationException& e) {
+        cerr << "Player advancement error: " << e.what() << endl;
+        return false;
+    }
+}
+
+int TournamentScheduler::advanceStage(const string& stageID) {
+    INSTRUMENT_FILE_SCOPE("TournamentScheduler::advanceStage");
+    try {
+        validateStageID(stageID);
+        if (stageID == "S003") {
+            throw ValidationException("Knockout is the highest stage");
+        }
+        string nextStage = (stageID == "S001") ? "S002" : "S003";
+
+        // Per-player result index built from one pass over the history
+        struct StageResult {
+            int wins;
+            int losses;
+        };
+        unordered_map<string, StageResult> results;
+        unordered_set<string> finished;
+        syncFile("MatchHistory.txt");
+        ifstream historyFile("MatchHistory.txt");
+        string line;
+        while (getline(historyFile, line)) {
+            stringstream ss(line);
+            string historyID, matchID, stage, p1ID, p2ID, score;
+            getline(ss, historyID, ',');
+            getline(ss, matchID, ',');
+            getline(ss, stage, ',');
+            getline(ss, p1ID, ',');
+            getline(ss, p2ID, ',');
+            getline(ss, score, ',');
+            if (stage != stageID) continue;
+            int score1 = 0, score2 = 0;
+            char dash;
+            stringstream scoreSS(score);
+            if (!(scoreSS >> score1 >> dash >> score2)) continue;
+            finished.insert(matchID);
+            StageResult& r1 = results[p1ID];
+            StageResult& r2 = results[p2ID];
+            if (score1 > score2) {
+                r1.wins++;
+                r2.losses++;
+            } else if (score2 > score1) {
+                r2.wins++;
+                r1.losses++;
+            }
+        }
+        historyFile.close();
+
+        // A stage (or round-robin group) advances only once every match in it has a result
+        bool byGroup = stageID == "S002" && !standings.empty();
+        unordered_map<string, string> groupOf;
+        if (byGroup) {
+            for (const string& group : standings.getGroupNames()) {
+                for (const GroupStanding& row : standings.getTable(group)) groupOf[row.playerID] = group;
+            }
+        }
+        int stageRows = 0;
+        map<string, int> unfinished;
+        for (int i = 0; i < matchesCount; ++i) {
+            const Matches& match = matches[i];
+            if (match.stageID != stageID) continue;
+            stageRows++;
+            if (match.matchStatus == DRAW_BYE_STATUS || match.matchStatus == "completed" ||
+                finished.count(match.matchID)) {
+                continue;
+            }
+            auto group = groupOf.find(match.p1ID);
+            unfinished[group == groupOf.end() ? "Stage " + stageID : "Group " + group -> second]++;
+        }
+        if (stageRows == 0) {
+            throw ValidationException("Stage " + stageID + " has no matches");
+        }
+        if (!unfinished.empty()) {
+            string incomplete;
+            for (const auto& part : unfinished) {
+                incomplete += (incomplete.empty() ? "" : ", ") + part.first + " (" + to_string(part.second) + ")";
+            }
+            throw ValidationException("Matches without a result in " + incomplete + "; no player was advanced");
+        }
+
+        unordered_set<string> qualifiers;
+        if (byGroup) {
+            standings.refresh();
+            for (const string& group : standings.getGroupNames()) {
+                vector<GroupStanding> table = standings.getTable(group);
+                for (int i = 0; i < (int)table.size() && i < QUALIFIERS_PER_GROUP; ++i) {
+                    if (table[i].played > 0) qualifiers.insert(table[i].playerID);
+                }
+            }
+        } else {
+            for (const auto& result : results) {
+                if (result.second.wins > 0 && result.second.losses == 0) {
+                    qualifiers.insert(result.first);
+                }
+            }
+            // A bye of the draw counts as a win without a match
+            for (int i = 0; i < matchesCount; ++i) {
+                if (matches[i].stageID == stageID && matches[i].matchStatus == DRAW_BYE_STATUS &&
+                    (!results.count(matches[i].p1ID) || results[matches[i].p1ID].losses == 0)) {
+                    qualifiers.insert(matches[i].p1ID);
+                }
+            }
+        }
+
+        int advanced = 0;
+        for (int i = 0; i < playersCount; ++i) {
+            if (players[i].stageID == stageID && qualifiers.count(players[i].playerID)) {
+                players[i].stageID = nextStage;
+                advanced++;
+            }
+        }
+        if (advanced > 0) {
+            savePlayersToFile();
+        }
+        cout << advanced << " players advanced from " << stageID << " to " << nextStage << "." << endl;
+        return advanced;
+    } catch (const ValidationException& e) {
+        cerr << "Stage advancement error: " << e.what() << endl;
+        return 0;
+    }
+}
+
+WriteHandle TournamentScheduler::savePlayersToFile() {
+    INSTRUMENT_FILE_SCOPE("TournamentScheduler::savePlayersToFile");
+    string contents;
+    contents.reserve(playersCount * 48);
+    for (int i = 0; i < playersCount; ++i) {
+        contents += players[i].playerID + "," + players[i].name + "," + players[i].nationality + ","
+                    + to_string(players[i].ranking) + "," + players[i].gender + "," + players[i].stageID + "\n";
+    }
+    WriteHandle saved = AsyncFileWriter::instance().rewrite("Players.txt", move(contents));
+
+    // Log the stages that differ from the event log's state
+    EventLog& eventLog = EventLog::instance();
+    if (!eventLog.isEnabled()) return saved;
+    vector<EventPayload> changes;
+    for (int i = 0; i < playersCount; ++i) {
+        string recorded = eventLog.recordedStage(players[i].playerID);
+        if (recorded != players[i].stageID) {
+            changes.push_back(PlayerAdvancedEvent{players[i].playerID, recorded, players[i].stageID});
+        }
+    }
+    eventLog.append(changes);
+    return saved;
+}
+
+void TournamentScheduler::restoreFromState(const TournamentState& state) {
+    delete[] matches;
+    matchesCount = 0;
+    matchesCapacity = max((int)state.matches.size(), 10);
+    matches = new Matches[matchesCapacity];
+    // Knockout matches are logged too, so the replayed state already holds the appended ones
+    appendedSeen = MatchIdSource::instance().appendedCount();
+    for (const MatchScheduledEvent& recorded : state.matches) {
+        matches[matchesCount++] = Matches{recorded.matchID, recorded.stageID, recorded.roundID, recorded.p1ID,
+                                          recorded.p2ID, recorded.scheduledTime, recorded.status, recorded.courtID};
+        MatchIdSource::instance().observe(recorded.matchID);
+    }
+    for (int i = 0; i < playersCount; ++i) {
+        auto it = state.playerStages.find(players[i].playerID);
+        if (it != state.playerStages.end()) players[i].stageID = it -> second;
+    }
+    initializeSchedules();
+    updateSchedulesFromMatches();
+}
+
+void TournamentScheduler::displayScheduledMatches() {
+    if (matchesCount == 0) {
+        cout << "No matches scheduled yet." << endl;
+        return;
+    }
+    
+    cout << "\n--- Scheduled Matches ---" << endl;
+    cout << left << setw(8) << "Match ID" 
+            << setw(10) << "Stage" 
+            << setw(10) << "Round" 
+            << setw(12) << "Player 1" 
+            << setw(12) << "Player 2" 
+            << setw(20) << "Time" 
+            << setw(12) << "Status" 
+            << setw(10) << "Court" << endl;
+    cout << string(84, '-') << endl;
+    
+    for (int i = 0; i < matchesCount; ++i) {
+        Matches& match = matches[i];
+        cout << left << setw(8) << match.matchID 
+                << setw(10) << match.stageID 
+                << setw(10) << match.roundID 
+                << setw(12) << match.p1ID 
+                << setw(12) << match.p2ID 
+                << setw(20) << formatMatchTime(match.scheduledTime) 
+                << setw(12) << match.matchStatus 
+                << setw(10) << match.courtID << endl;
+    }
+}
+
+void TournamentScheduler::displayAllAvailablePlayers() {
+    cout << "\n--- Available Players by Stage ---" << endl;
+    
+    cout << "\nStage S001 (Qualifier):" << endl;
+    displayAvailablePlayers("S001");
+    
+    cout << "\nStage S002 (Round Robin):" << endl;
+    displayAvailablePlayers("S002");
+    
+    cout << "\nStage S003 (Knockout):" << endl;
+    displayAvailablePlayers("S003");
+}
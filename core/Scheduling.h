@@ -0,0 +1,1033 @@
+#ifndef CORE_SCHEDULING_H
+#define CORE_SCHEDULING_H
+
+#include "Common.h"
+#include "Instrumentation.h"
+#include "Logger.h"
+#include "EventLog.h"
+#include "AsyncWriter.h"
+#include "HistoryScan.h"
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------
+ * -------------------------------- Tournament Scheduling and Player Progression ----------------------------------
+ * ----------------------------------------------------------------------------------------------------------------
+ */
+// Custom exception class for validation errors
+class ValidationException : public runtime_error {
+    public:
+        ValidationException(const string& message) 
+            : runtime_error(message) {}
+};
+
+// Structure for a Court
+struct Courts {
+    string courtID;
+    string courtType;
+    int capacity;
+    int maxConcurrentMatches;
+};
+
+// Structure for a Player
+class Players {
+    public:
+        string playerID;
+        string name;
+        string nationality;
+        int ranking;
+        char gender;
+        string stageID;
+};
+
+// Structure for a Match
+class Matches {
+    public:
+        string matchID;
+        string stageID;
+        string roundID;
+        string p1ID;
+        string p2ID;
+        MatchTime scheduledTime;
+        string matchStatus;
+        string courtID;
+};
+
+/**
+ * The one source of match IDs in the program. TournamentScheduler and KnockoutBracket both number their
+ * matches here, so they never hand out the same ID. A match appended to Matches.txt by the bracket is also
+ * kept here: a live scheduler adds it to its own list before rewriting the file, so the rewrite keeps it.
+ */
+class MatchIdSource {
+    private:
+        mutex lock;
+        int lastNumber;             // Highest match number handed out or seen
+        bool seeded;                // lastNumber includes the IDs in Matches.txt
+        vector<Matches> appended;   // Matches appended to Matches.txt outside a scheduler, oldest first
+
+        MatchIdSource() : lastNumber(0), seeded(false) {}
+
+    public:
+        static MatchIdSource& instance();
+
+        // Number of a match ID such as M012, 0 if it has none
+        static int numberOf(const string& matchID);
+
+        // Format a match number as an ID e.g. M012
+        static string format(int number);
+
+        // Hand out the next unused match ID
+        string next();
+
+        // Note an ID that is already in use
+        void observe(const string& matchID);
+
+        // Keep a match that was appended to Matches.txt outside a scheduler
+        void recordAppended(const Matches& match);
+
+        // Number of matches recorded by recordAppended so far
+        size_t appendedCount();
+
+        // The appended matches from an index on
+        vector<Matches> appendedSince(size_t index);
+};
+
+// Structure for a Time Slot
+struct TimeSlot {
+    MatchTime startTime;
+    string courtID;
+    int concurrentCount;
+};
+
+// Constants for the Schedule Grid
+const int DAY_FIRST_HOUR = 7;       // First match of the day starts at 07:00
+const int SLOTS_PER_DAY = 12;       // Hourly slots from 07:00 to 18:00
+const int MIN_REST_SLOTS = 2;       // A player needs one free slot between two matches
+
+/**
+ * Places a batch of matches on an hourly grid over all courts and days.
+ * Hard constraints: court concurrency (Courts::maxConcurrentMatches), player rest
+ * between matches and phase ordering (stage, then round). The objective is the
+ * makespan (last used slot). A deterministic greedy pass is followed by randomised
+ * greedy restarts until the time budget runs out.
+ */
+class ScheduleOptimizer {
+    private:
+        struct Placement {
+            string p1ID;
+            string p2ID;
+            int phase;
+            int slot;       // Grid slot, -1 until placed
+            int courtIndex;
+        };
+
+        const Courts* courts;
+        int courtsCount;
+        MatchTime gridStart;    // Start of the first day of the grid
+        int firstSlot;          // First slot the batch may use
+        vector<Placement> batch;
+        vector<Placement> fixed;
+        map<int, int> fixedPhaseLastSlot; // Last grid slot used by fixed matches of each phase
+
+        /**
+         * Check that a player has enough rest around a slot
+         * Slots of different days never clash: the night between them is rest enough.
+         * @param busy the slots the player already plays in
+         * @param slot the slot to check
+         */
+        static bool isRested(const vector<int>& busy, int slot);
+
+        /**
+         * Place the batch greedily in the given order
+         * @param order the batch indices sorted by phase
+         * @param slots Output: the slot of each batch match
+         * @param courtIndexes Output: the court of each batch match
+         * @return the makespan (last slot used + 1)
+         */
+        int placeGreedy(const vector<int>& order, vector<int>& slots, vector<int>& courtIndexes) const;
+
+    public:
+        /**
+         * Create an optimizer for a grid starting at a given time
+         * @param courtList the courts
+         * @param count the number of courts
+         * @param replanFrom matches of the batch are placed at or after this time
+         */
+        ScheduleOptimizer(const Courts* courtList, int count, MatchTime replanFrom);
+
+        /**
+         * Convert a grid slot to a match time
+         * @param slot the grid slot
+         */
+        MatchTime slotToTime(int slot) const;
+
+        /**
+         * Convert a match time to a grid slot
+         * @param time the match time
+         * @return the slot, or -1 if the time is not on the grid
+         */
+        int timeToSlot(MatchTime time) const;
+
+        /**
+         * Add a match that keeps its place but still occupies its court and players
+         * @param p1ID the first player
+         * @param p2ID the second player
+         * @param time the scheduled time
+         * @param courtIndex the court index
+         * @param phase the phase of the match
+         */
+        void addFixed(const string& p1ID, const string& p2ID, MatchTime time, int courtIndex, int phase);
+
+        /**
+         * Add a match to place
+         * @param p1ID the first player
+         * @param p2ID the second player
+         * @param phase the phase of the match (stage and round)
+         * @return the index of the match in the batch
+         */
+        int addMatch(const string& p1ID, const string& p2ID, int phase);
+
+        /**
+         * Place the batch, improving the plan until the time budget runs out
+         * @param budgetMs the time budget in milliseconds
+         * @return the number of plans tried, 0 if the batch cannot be placed (no court takes a match)
+         */
+        int optimize(int budgetMs);
+
+        // Time of a batch match, TIME_TBD if it was not placed
+        MatchTime getTime(int index) const { return batch[index].slot < 0 ? TIME_TBD : slotToTime(batch[index].slot); }
+        // Court of a batch match, -1 if it was not placed
+        int getCourtIndex(int index) const { return batch[index].courtIndex; }
+
+        // Time the last placed match starts
+        MatchTime getLastStart() const;
+};
+
+// Phase of a match for ordering: stage first, then round
+int getMatchPhase(const string& stageID, const string& roundID);
+
+// Constants for Round Robin
+const int DEFAULT_GROUP_SIZE = 4;   // Players per round-robin group
+const int QUALIFIERS_PER_GROUP = 2; // Players of each group that reach the knockout
+
+// Structure for a Group Standing row
+struct GroupStanding {
+    string playerID;
+    int played;
+    int wins;
+    int losses;
+    int pointsFor;
+    int pointsAgainst;
+};
+
+/**
+ * Round-robin group standings built from MatchHistory.txt.
+ * Only the lines appended since the last refresh are read, so standings stay
+ * current as results arrive without rescanning the whole history.
+ */
+class GroupStandings {
+    private:
+        string groupsFile;
+        string historyFile;
+        map<string, string> playerGroup;                 // playerID -> group
+        map<string, map<string, GroupStanding>> groups;  // group -> playerID -> standing
+        streamoff consumed;                              // Bytes of the history already applied
+
+        /**
+         * Apply one history line to the standings (a line with level scores is skipped)
+         * @param line the history line
+         */
+        void applyResult(const string& line);
+
+        // Reset every standing to zero, keeping the group members
+        void resetTables();
+
+    public:
+        GroupStandings(const string& groupsFilename = "Groups.txt", const string& historyFilename = "MatchHistory.txt");
+
+        // Load the group of every player from the groups file
+        void loadGroups();
+
+        /**
+         * Save the groups and start the standings from zero
+         * @param members the groups, each a list of player IDs
+         */
+        void setGroups(const vector<vector<string>>& members);
+
+        // Apply the results appended to the history since the last refresh
+        void refresh();
+
+        /**
+         * Get a group's standings, best first (wins, then point difference)
+         * @param group the group name
+         */
+        vector<GroupStanding> getTable(const string& group);
+
+        vector<string> getGroupNames() const;
+
+        bool empty() const { return playerGroup.empty(); }
+
+        // Display the standings of every group
+        void display();
+};
+
+// Constants for the Knockout Bracket
+const string BRACKET_BYE = "-";         // Empty bracket position (also the opponent of a draw's bye)
+const string DRAW_BYE_STATUS = "bye";   // Status of the row recording a draw's bye
+const string KNOCKOUT_COURT = "C003";   // Knockout matches are played on the Progression Court
+
+// Structure for a Bracket Node (a leaf is a seed, an inner node is a match)
+struct BracketNode {
+    string playerID;    // Winner of the match (or the seeded player), "" while undecided
+    string matchID;     // Match deciding this node, "" if none scheduled
+    MatchTime time;     // Scheduled time of the match
+};
+
+/**
+ * Knockout bracket stored as an implicit binary tree in an array.
+ * Node 0 is the final, the children of node i are 2i+1 and 2i+2, and the
+ * leaves hold the seeds. A result moves the winner one level up; once both
+ * children of a match are known the match is scheduled, so a result costs
+ * at most one walk to the root.
+ */
+class KnockoutBracket {
+    private:
+        string filename;
+        int leafCount;
+        vector<BracketNode> nodes;
+        unordered_map<string, int> matchNodes;  // matchID -> node
+        set<MatchTime> usedTimes;               // Times already taken on the knockout court
+        mutable long long fileSize;             // Size of the bracket file when last loaded or saved
+        mutable long long fileModified;         // Modification time (ns) of the bracket file then
+
+        int parentOf(int node) const { return (node - 1) / 2; }
+        int siblingOf(int node) const { return (node % 2 == 1) ? node + 1 : node - 1; }
+
+        /**
+         * Get the round of a match node (1 = first round)
+         * @param node the node index
+         */
+        int roundOf(int node) const;
+
+        /**
+         * Find the first free hourly slot on the knockout court at or after a time
+         * @param ready the earliest time
+         */
+        MatchTime nextFreeTime(MatchTime ready) const;
+
+        /**
+         * Read the scheduler's matches from Matches.txt and mark their times on the knockout court as used
+         * @return the earliest start of a knockout match: the first slot of the grid, or the rest after
+         *         the last match of an earlier stage, as the scheduler's getStageStart computes it
+         */
+        MatchTime readScheduledMatches();
+
+        // Remember the size and modification time of the bracket file
+        void rememberFileState() const;
+
+        /**
+         * Schedule the match of a node whose players are both known and append it to Matches.txt
+         * @param node the node index
+         */
+        void scheduleNodeMatch(int node);
+
+    public:
+        KnockoutBracket(const string& file = "Bracket.txt") : filename(file), leafCount(0), fileSize(-1), fileModified(-1) {}
+
+        /**
+         * Load the bracket from its file
+         * @return True if a bracket was loaded, else False
+         */
+        bool load();
+
+        /**
+         * Load the bracket again if its file changed since the last load or save (a new draw, another process)
+         * @return True if the bracket was reloaded, else False
+         */
+        bool refresh();
+
+        // Save the bracket: the leaf count, then one line per node that holds anything
+        void save() const;
+
+        /**
+         * Build a new bracket from seeded players (best seed first)
+         * Seeds are placed so the top two seeds can only meet in the final; missing seeds are byes.
+         * @param seededPlayers the player IDs in seed order
+         */
+        void build(const vector<string>& seededPlayers);
+
+        /**
+         * Get the match nodes whose two players are known but have no match yet
+         */
+        vector<int> getReadyMatches() const;
+
+        /**
+         * Record the match scheduled for a node
+         * @param node the node index
+         * @param matchID the match ID
+         * @param time the scheduled time
+         */
+        void assignMatch(int node, const string& matchID, MatchTime time);
+
+        string getRoundID(int node) const;
+
+        const string& getPlayer1(int node) const { return nodes[2 * node + 1].playerID; }
+        const string& getPlayer2(int node) const { return nodes[2 * node + 2].playerID; }
+
+        /**
+         * Find the node of a knockout match
+         * @param matchID the match ID
+         * @return the node index, or -1 if the match is not in the bracket
+         */
+        int findMatch(const string& matchID) const;
+
+        /**
+         * Record the winner of a knockout match and move them up the bracket
+         * @param matchID the match ID
+         * @param winnerID the winner
+         * @return True if the bracket changed, else False
+         */
+        bool reportResult(const string& matchID, const string& winnerID);
+
+        bool empty() const { return leafCount == 0; }
+
+        // Display the bracket round by round
+        void display() const;
+};
+
+/**
+ * Order-statistic tree (treap) over unique keys.
+ * Every node keeps its subtree size, so insert, erase, rank and k-th lookups are O(log n).
+ */
+template <typename Key, typename Compare = less<Key>>
+class RankedTree {
+    private:
+        struct TreeNode {
+            Key key;
+            uint32_t priority;
+            int size;
+            int left;
+            int right;
+        };
+
+        vector<TreeNode> pool;
+        vector<int> freeNodes;
+        int root;
+        Compare isLess;
+        mt19937 rng;
+
+        int sizeOf(int node) const { return node == -1 ? 0 : pool[node].size; }
+
+        void update(int node) {
+            pool[node].size = 1 + sizeOf(pool[node].left) + sizeOf(pool[node].right);
+        }
+
+        int merge(int left, int right) {
+            if (left == -1) return right;
+            if (right == -1) return left;
+            if (pool[left].priority > pool[right].priority) {
+                pool[left].right = merge(pool[left].right, right);
+                update(left);
+                return left;
+            }
+            pool[right].left = merge(left, pool[right].left);
+            update(right);
+            return right;
+        }
+
+        // Split into keys less than key (left) and the rest (right)
+        void split(int node, const Key& key, int& left, int& right) {
+            if (node == -1) {
+                left = right = -1;
+                return;
+            }
+            if (isLess(pool[node].key, key)) {
+                split(pool[node].right, key, pool[node].right, right);
+                left = node;
+            } else {
+                split(pool[node].left, key, left, pool[node].left);
+                right = node;
+            }
+            update(node);
+        }
+
+        int eraseFrom(int node, const Key& key, bool& removed) {
+            if (node == -1) return -1;
+            if (isLess(key, pool[node].key)) {
+                int child = eraseFrom(pool[node].left, key, removed);
+                pool[node].left = child;
+            } else if (isLess(pool[node].key, key)) {
+                int child = eraseFrom(pool[node].right, key, removed);
+                pool[node].right = child;
+            } else {
+                int replacement = merge(pool[node].left, pool[node].right);
+                freeNodes.push_back(node);
+                removed = true;
+                return replacement;
+            }
+            update(node);
+            return node;
+        }
+
+    public:
+        RankedTree() : root(-1), rng(2025) {}
+
+        void clear() {
+            pool.clear();
+            freeNodes.clear();
+            root = -1;
+        }
+
+        int size() const { return sizeOf(root); }
+
+        /**
+         * Insert a key that is not in the tree yet
+         * @param key the key to insert
+         */
+        void insert(const Key& key) {
+            int node;
+            if (!freeNodes.empty()) {
+                node = freeNodes.back();
+                freeNodes.pop_back();
+                pool[node] = TreeNode{key, (uint32_t)rng(), 1, -1, -1};
+            } else {
+                node = pool.size();
+                pool.push_back(TreeNode{key, (uint32_t)rng(), 1, -1, -1});
+            }
+            int left, right;
+            split(root, key, left, right);
+            root = merge(merge(left, node), right);
+        }
+
+        /**
+         * Remove a key
+         * @param key the key to remove
+         * @return True if the key was in the tree, else False
+         */
+        bool erase(const Key& key) {
+            bool removed = false;
+            root = eraseFrom(root, key, removed);
+            return removed;
+        }
+
+        /**
+         * Count the keys ordered before a key (0-based rank)
+         * @param key the key to rank
+         */
+        int rankOf(const Key& key) const {
+            int rank = 0;
+            int node = root;
+            while (node != -1) {
+                if (isLess(pool[node].key, key)) {
+                    rank += sizeOf(pool[node].left) + 1;
+                    node = pool[node].right;
+                } else {
+                    node = pool[node].left;
+                }
+            }
+            return rank;
+        }
+
+        /**
+         * Get the key at a 0-based rank
+         * @param rank the rank, must be below size()
+         */
+        const Key& kth(int rank) const {
+            int node = root;
+            while (true) {
+                int leftSize = sizeOf(pool[node].left);
+                if (rank < leftSize) {
+                    node = pool[node].left;
+                } else if (rank == leftSize) {
+                    return pool[node].key;
+                } else {
+                    rank -= leftSize + 1;
+                    node = pool[node].right;
+                }
+            }
+        }
+};
+
+// Constants for Ratings
+const double DEFAULT_RATING = 1500.0;   // Rating of a player without results
+const double ELO_K_FACTOR = 32.0;       // Largest rating change of one match
+
+// Leaderboard key: rating and player ID
+typedef pair<double, string> RatingKey;
+
+// Orders ratings from highest to lowest, then by player ID
+struct HigherRatingFirst {
+    bool operator()(const RatingKey& a, const RatingKey& b) const {
+        if (a.first != b.first) return a.first > b.first;
+        return a.second < b.second;
+    }
+};
+
+// Structure for one rated result read from the history
+struct RatedResult {
+    string p1ID;
+    string p2ID;
+    int score1;
+    int score2;
+};
+
+/**
+ * Elo ratings fed by the match history.
+ * Ratings carry over for the whole history: there is no seasonal reset, so a player's rating reflects
+ * every recorded result in the order it was recorded. Results are applied incrementally as matches are
+ * recorded; a full recompute is one sequential pass over MatchHistory.txt (Elo depends on result order).
+ * The ratings are kept in an order-statistic tree for O(log n) rank queries.
+ */
+class RatingEngine {
+    private:
+        unordered_map<string, double> ratings;
+        RankedTree<RatingKey, HigherRatingFirst> leaderboard;
+
+        /**
+         * Apply one result to a rating table
+         * @param table the ratings to update
+         * @param result the match result
+         */
+        static void applyElo(unordered_map<string, double>& table, const RatedResult& result);
+
+        // Rebuild the leaderboard from the live ratings
+        void rebuildLeaderboard();
+
+    public:
+        /**
+         * Apply a recorded match to the live ratings
+         * @param p1ID the first player
+         * @param p2ID the second player
+         * @param score1 the first player's score
+         * @param score2 the second player's score
+         */
+        void applyResult(const string& p1ID, const string& p2ID, int score1, int score2);
+
+        /**
+         * Apply one history row to the ratings, without touching the leaderboard (see finishRecompute)
+         * @param row the history row
+         * @return True if the row holds a result, else False
+         */
+        bool applyHistoryRow(const HistoryRowView& row);
+
+        // Rank the ratings built by applyHistoryRow
+        void finishRecompute() { rebuildLeaderboard(); }
+
+        /**
+         * Recompute all ratings from the history file in one pass
+         * @param filename the match history file
+         * @return the number of results applied
+         */
+        int recomputeFromHistory(const string& filename);
+
+        // Forget every rating
+        void clear();
+
+        bool hasRatings() const { return !ratings.empty(); }
+
+        double getRating(const string& playerID) const;
+
+        /**
+         * Get a player's position on the leaderboard
+         * @param playerID the player ID
+         * @return the 1-based rank, 0 if the player has no rating
+         */
+        int getRank(const string& playerID) const;
+
+        /**
+         * Get the leaderboard entries between two 1-based ranks
+         * @param fromRank the first rank
+         * @param toRank the last rank (inclusive)
+         */
+        vector<RatingKey> getRange(int fromRank, int toRank) const;
+
+        // Display the top of the leaderboard
+        void display(int topCount) const;
+};
+
+// Leaderboard key: wins, matches played and player ID
+struct WinRateKey {
+    int wins;
+    int played;
+    string playerID;
+};
+
+// Orders by win rate from highest to lowest, then by matches played, then by player ID
+struct HigherWinRateFirst {
+    bool operator()(const WinRateKey& a, const WinRateKey& b) const {
+        // Cross-multiplied so equal rates compare exactly
+        long long rateA = (long long)a.wins * b.played;
+        long long rateB = (long long)b.wins * a.played;
+        if (rateA != rateB) return rateA > rateB;
+        if (a.played != b.played) return a.played > b.played;
+        return a.playerID < b.playerID;
+    }
+};
+
+/**
+ * Win rate leaderboard kept up to date as results are appended to the history.
+ * Each result moves two keys in an order-statistic tree, so top-K, rank and
+ * rank range queries are O(log n) per entry without sorting all players.
+ */
+class WinRateBoard {
+    private:
+        unordered_map<string, WinRateKey> records;
+        RankedTree<WinRateKey, HigherWinRateFirst> leaderboard;
+
+        /**
+         * Add one match to a player's record and move the player's key
+         * @param playerID the player ID
+         * @param won True if the player won the match
+         */
+        void addMatch(const string& playerID, bool won);
+
+    public:
+        /**
+         * Apply one match result
+         * @param p1ID the first player
+         * @param p2ID the second player
+         * @param winnerID the winner of the match
+         */
+        void recordResult(const string& p1ID, const string& p2ID, const string& winnerID);
+
+        /**
+         * Apply one history row
+         * @param row the history row
+         * @return True if the row holds a result, else False
+         */
+        bool applyHistoryRow(const HistoryRowView& row);
+
+        /**
+         * Rebuild the leaderboard from the history file in one pass
+         * @param filename the match history file
+         * @return the number of results applied
+         */
+        int loadFromHistory(const string& filename);
+
+        // Forget every record
+        void clear();
+
+        int size() const { return leaderboard.size(); }
+
+        /**
+         * Get a player's position on the leaderboard
+         * @param playerID the player ID
+         * @return the 1-based rank, 0 if the player has no matches
+         */
+        int getRank(const string& playerID) const;
+
+        /**
+         * Get the leaderboard entries between two 1-based ranks
+         * @param fromRank the first rank
+         * @param toRank the last rank (inclusive)
+         */
+        vector<WinRateKey> getRange(int fromRank, int toRank) const;
+
+        /**
+         * Display the leaderboard entries between two 1-based ranks
+         * @param fromRank the first rank
+         * @param toRank the last rank (inclusive)
+         */
+        void display(int fromRank, int toRank) const;
+};
+
+// Main TournamentScheduler class
+class TournamentScheduler {
+    private:
+        Courts* courts;
+        int courtsCount;
+        Matches* matches;
+        int matchesCount;
+        int matchesCapacity;
+        Players* players;
+        int playersCount;
+        int playersCapacity;
+        vector<queue<TimeSlot>> courtSchedules;
+        size_t appendedSeen;        // Matches of MatchIdSource::appendedSince already in the list
+        GroupStandings standings;   // Round-robin standings, refreshed from the history as results arrive
+
+        /**
+         * Initialize the schedules for each court
+         */
+        void initializeSchedules();
+
+        /**
+         * Resize the matches array when it reaches capacity
+         */
+        void resizeMatchesArray();
+
+        /**
+         * Resize the players array when it reaches capacity
+         */
+        void resizePlayersArray();
+
+        /**
+         * Validate the player ID format
+         * @param playerID the player ID to validate
+         */
+        void validatePlayerID(const string& playerID);
+
+        /**
+         * Validate the stage ID format
+         * @param stageID the stage ID to validate
+         */
+        void validateStageID(const string& stageID);
+
+        /**
+         * Load the players from the Players.txt file
+         */
+        void loadPlayers();
+
+        /**
+         * Load the matches from the Matches.txt file
+         */
+        void loadMatches();
+
+        /**
+         * Update the court schedules based on the matches
+         */
+        void updateSchedulesFromMatches();
+
+        /**
+         * Count a match in the court schedule slot it is placed in
+         * @param match the match
+         */
+        void bookMatchSlot(const Matches& match);
+
+        /**
+         * Get the court index from the court ID
+         * @param courtID the court ID to search for
+         * @return the index of the court in the array
+         */
+        int getCourtIndexFromID(const string& courtID);
+
+        /**
+         * Get the court index from the stage ID
+         * @param stageID the stage ID to search for
+         * @return the index of the court in the array
+         */
+        int getCourtIndexFromStage(const string& stageID);
+
+        /**
+         * Get the next available time slot for a match in a stage
+         * @param stageID the stage ID to search for
+         * @return the next available time slot, TIME_TBD if none is free
+         */
+        MatchTime getNextAvailableTimeSlot(const string& stageID);
+
+        /**
+         * Generate the next match ID
+         * @return the match ID e.g. M001
+         */
+        string generateMatchID();
+
+        /**
+         * Add the knockout matches appended to Matches.txt since this scheduler loaded it,
+         * so a rewrite of the file keeps them
+         */
+        void mergeAppendedMatches();
+
+        /**
+         * Collect the players that already have a match
+         * @return the IDs of the booked players
+         */
+        unordered_set<string> getBookedPlayers();
+
+        /**
+         * Sort players by seed: live Elo rating when the history has results, else ranking
+         * @param seeds the player indices to sort
+         */
+        void sortBySeed(vector<int>& seeds);
+
+        /**
+         * Get the earliest time a stage may start: after every match of the earlier stages, with rest
+         * @param stageID the stage ID e.g. S003
+         * @return the time, TIME_TBD if no earlier stage match is scheduled
+         */
+        MatchTime getStageStart(const string& stageID) const;
+
+        /**
+         * Take several time slots of a stage's court in one pass over its schedule
+         * When the court's slots at or after notBefore run out, the court gets further days of slots.
+         * @param stageID the stage ID to search for
+         * @param count the number of slots needed
+         * @param notBefore the earliest slot time, TIME_TBD for none
+         * @return the slot times, TIME_TBD for matches that did not fit
+         */
+        vector<MatchTime> takeTimeSlots(const string& stageID, int count, MatchTime notBefore = TIME_TBD);
+
+        /**
+         * Generate the first-round draw of an elimination stage seeded by ranking (1 vs last, 2 vs second last, ...)
+         * With an odd field the middle seed gets a bye, saved as a DRAW_BYE_STATUS row against BRACKET_BYE.
+         * The round robin stage S002 is drawn by generateRoundRobinMatches instead.
+         * @param stageID the stage to draw
+         * @param booked the players that already have a match, updated with the new pairings
+         * @return the number of matches added
+         */
+        int generateStageDraw(const string& stageID, unordered_set<string>& booked);
+
+        /**
+         * Save the matches to the Matches.txt file (written by the background writer)
+         * @return the handle of the write
+         */
+        WriteHandle saveMatchesToFile();
+
+        /**
+         * Place the matches from an index onwards with the optimizer, keeping earlier matches fixed
+         * @param firstIndex the first match to place
+         * @param budgetMs the time budget for the optimizer in milliseconds
+         */
+        void placeNewMatches(int firstIndex, int budgetMs);
+
+        /**
+         * Build the knockout bracket from the unbooked S003 players and add its ready matches
+         * @param booked the players that already have a match, updated with the new pairings
+         * @return the number of matches added
+         */
+        int generateKnockoutMatches(unordered_set<string>& booked);
+
+        /**
+         * Split the unbooked S002 players into groups and add every round-robin pairing
+         * Groups are snake-seeded by ranking; pairings use the circle method with one roundID per round.
+         * @param groupSize the number of players per group
+         * @param booked the players that already have a match, updated with the new pairings
+         * @return the number of matches added
+         */
+        int generateRoundRobinMatches(int groupSize, unordered_set<string>& booked);
+
+    public:
+        /**
+         * Constructor to initialize the tournament scheduler
+         */
+        TournamentScheduler();
+
+        /**
+         * Destructor to clean up memory
+         */
+        ~TournamentScheduler();
+        bool createCourtFile();
+        
+        /**
+         * Load court data from Court.txt file
+         * @param courts Pointer to courts array
+         * @param courtsCount Reference to court count
+         * @return True if successful, false otherwise
+         */
+        bool loadCourtsFromFile(Courts* &courts, int &courtsCount);
+        
+        /**
+         * Save court data to Court.txt file
+         * @param courts Pointer to courts array
+         * @param courtsCount Number of courts
+         * @return True if successful, false otherwise
+         */
+        bool saveCourtsToFile(Courts* courts, int courtsCount);
+
+        /**
+         * Display the available players in a stage
+         * @param stageID the stage ID to search for
+         */
+        void displayAvailablePlayers(const string& stageID);
+
+        /**
+         * Schedule a match between two players
+         * @param p1ID the ID of player 1
+         * @return true if the match was scheduled successfully
+         */
+        bool scheduleMatch(const string& p1ID);
+
+        /**
+         * Schedule the draws of all stages (Qualifier, Round Robin, Knockout) from the players
+         * that are not booked yet, and save every new match with one write
+         * @return the number of matches scheduled
+         */
+        int scheduleAllStages();
+
+        /**
+         * Generate round-robin groups for stage S002 and schedule every round
+         * Each round's matches run side by side across all courts; rounds follow one another.
+         * @param groupSize the number of players per group
+         * @return the number of matches scheduled
+         */
+        int scheduleRoundRobin(int groupSize);
+
+        /**
+         * Generate the knockout bracket for stage S003 and schedule its first matches
+         * @return the number of matches scheduled
+         */
+        int scheduleKnockout();
+
+        /**
+         * Re-plan the waiting matches over all courts and days
+         * @param budgetMs the time budget for the optimizer in milliseconds
+         * @param replanFrom only waiting matches at or after this time (or TBD) move
+         * @return the number of matches placed
+         */
+        int optimizeSchedule(int budgetMs, MatchTime replanFrom);
+
+        /**
+         * Advance a player to the next stage
+         * @param playerID the ID of the player to advance
+         * @return true if the player was advanced successfully
+         */
+        bool advancePlayerStage(const string& playerID);
+
+        /**
+         * Advance every qualifier of a stage in one pass and save the players once
+         * Qualifier: every player with a win and no loss in the stage's results, and every bye holder without a loss.
+         * Round Robin: the top QUALIFIERS_PER_GROUP of each group (falls back to the qualifier rule without groups).
+         * Nobody advances while the stage has no matches or any of its matches has no result; the stage
+         * (or each round-robin group) still waiting for results is reported.
+         * @param stageID the stage to close
+         * @return the number of players advanced
+         */
+        int advanceStage(const string& stageID);
+
+        /**
+         * Save the players to the Players.txt file (written by the background writer)
+         * @return the handle of the write
+         */
+        WriteHandle savePlayersToFile();
+
+        /**
+         * Replace the matches and player stages with a state rebuilt from the event log
+         * Players keep their file records; only the stages recorded in the state change.
+         * @param state the replayed state
+         */
+        void restoreFromState(const TournamentState& state);
+
+        // Display the round-robin standings with the results recorded since the last view
+        void displayStandings() { standings.display(); }
+
+        int getMatchCount() const { return matchesCount; }
+        const Matches& getMatch(int index) const { return matches[index]; }
+
+        /**
+         * Display the scheduled matches
+         */
+        void displayScheduledMatches();
+
+        /**
+         * Display all available players by stage
+         */
+        void displayAllAvailablePlayers();
+};
+
+struct matchHistory {
+    string matchId;
+    string stage;
+    string p1Id;
+    string p2Id;
+    string setScores;
+    string matchedTime;
+    string duration;
+};
+
+// Player lookups from Players.txt
+map<string, string> readPlayersByName(const string& filename);
+map<string, string> readPlayersByID(const string& filename);
+
+// Match history rows used by the performance report
+const size_t HISTORY_ROW_BYTES = 64;        // Smallest usual MatchHistory.txt row, to reserve from the file size
+void readMatches(const string& filename, vector<matchHistory>& matches);
+
+#endif
@@ -0,0 +1,1452 @@
+#include "Ticketing.h"
+
+/**
+ * Insert new spectator value based on priority (adding people in order)
+ * @param context The ticketing session
+ * @param spectator The spectator to add
+ */
+void enqueuePriorityQueue(TicketingContext& context, Spectator* spectator) {
+    // Create a new node for the spectator
+    Node* newNode = new Node{spectator, nullptr};
+    int spectatorPriority = spectator->priority;  // Get the priority of the spectator
+    // Check if the queue is empty or highest priority spectator than the front (Vip> General> Early-bird)
+    if (context.ticketQueueFront == nullptr || spectatorPriority > (context.ticketQueueFront -> spectator -> priority)) {
+        // Insert at front
+        newNode -> next = context.ticketQueueFront;
+        context.ticketQueueFront = newNode;
+    } else {
+        // Start from the front of the queue
+        Node* current = context.ticketQueueFront;
+        while (current -> next != nullptr && (current -> next -> spectator -> priority) >= spectatorPriority) {
+            current = current -> next;
+        }
+        // Insert the new node in the correct position
+        newNode -> next = current -> next;
+        current -> next = newNode;
+    }
+}
+
+/**
+ * Function to remove and return the highest priority spectator from the Priority Queue
+ * @param context The ticketing session
+ * @return The spectator with the highest priority
+ */
+Spectator* dequeuePriorityQueue(TicketingContext& context) {
+    if (context.ticketQueueFront == nullptr) {
+        return nullptr;
+    }
+    Node* temp = context.ticketQueueFront;
+    Spectator* spectator = temp -> spectator;
+    context.ticketQueueFront = context.ticketQueueFront -> next;
+    delete temp;
+    return spectator;
+}
+
+/**
+ * Check if the priority queue is empty
+ * @param context The ticketing session
+ * @return True if the queue is empty, else False
+ */
+bool isPriorityQueueEmpty(const TicketingContext& context) {
+    // Return true if the queue is empty, else return false
+    return context.ticketQueueFront == nullptr;
+}
+
+/**
+ * Function to add the spectator to spectator list
+ * @param context The ticketing session
+ * @param spectator The spectator to add
+ */
+void addToSpectatorList(TicketingContext& context, Spectator* spectator) {
+    // Create a new node for the spectator
+    Node* newNode = new Node{spectator, nullptr};
+    // Insert at the head of the list
+    newNode -> next = context.spectatorList;
+    // Update the head to the new node
+    context.spectatorList = newNode;
+}
+
+/**
+ * Function to search for a Spectator by TicketID
+ * @param context The ticketing session
+ * @param ticketID The TicketID to search
+ * @return The Spectator if found, else nullptr
+ */
+Spectator* searchByTicketID(const TicketingContext& context, const string& ticketID) {
+    // Start from the head of the spectator list
+    Node* current = context.spectatorList;
+    // Traverse the spectator list
+    while (current != nullptr) {
+        // Check if the ticketID match
+        if (current -> spectator -> ticketID == ticketID) {
+            // Return the spectator if found
+            return current -> spectator;
+        }
+        // Move to the next node
+        current = current -> next;
+    }
+    // Return nullptr if the ticketID is not found
+    return nullptr;
+}
+
+/**
+ * Function to get the current capacity of a court
+ * @param context The ticketing session
+ * @param courtID The ID of the court
+ * @return The capacity of the court
+ */
+int getCourtCapacity(const TicketingContext& context, const string& courtID) {
+    // Loop through the array of courts
+    for (int i = 0; i < NUM_COURTS; i++) {
+        if (context.courts[i].courtID == courtID) {
+            return context.courts[i].capacity; // Return the capacity of the court
+        }
+    }
+    // Error handling when the court is not found
+    LOG_EVENT(LOG_WARN, "court.notFound", "\nCourtID not found.\n", {"courtID", courtID});
+    return 0;
+}
+
+/**
+ * Function to update the court capacity (during entry and exit)
+ * @param context The ticketing session
+ * @param courtID The ID of the court
+ * @param seats The number of seats to update
+ * @param isEntry True: Entry, False: Exit
+ * @param showOutput True: Display the updated capacity, False: Do not display
+ */
+void updateCourtCapacity(TicketingContext& context, const string& courtID, int seats, bool isEntry, bool showOutput) {
+    // Loop the court array
+    for (int i = 0; i < NUM_COURTS; i++) {
+        // Check if the courtID match
+        if (context.courts[i].courtID == courtID) {
+            // If the spectators enter
+            if (isEntry) {
+                // Decrease the capacity
+                context.courts[i].capacity -= seats;
+            } 
+            // If the spectators exit
+            else {
+                // Increase the capacity
+                context.courts[i].capacity += seats;
+            }
+            // If the output is enabled to diaplay about the capacity, show the results
+            if (showOutput) {
+                LOG_EVENT(LOG_INFO, "court.capacity", "\nUpdated capacity for court " << courtID << ": " << context.courts[i].capacity << "\n",
+                          {"courtID", courtID}, {"capacity", to_string(context.courts[i].capacity)});
+            }
+            // Exit for loop
+            break;
+        }
+    }
+}
+
+/**
+ * Create SeatMap.txt with the default layout matching the court capacities
+ * @return True if successful, else False
+ */
+bool createSeatMapFile() {
+    INSTRUMENT_FILE_SCOPE("createSeatMapFile");
+    ofstream seatFile("SeatMap.txt");
+    if (!seatFile) {
+        cout << "Error: Could not create SeatMap.txt file.\n";
+        return false;
+    }
+    // CourtID,Section,Rows,SeatsPerRow
+    seatFile << "C001,A,10,30\n" << "C001,B,10,30\n" << "C001,C,10,30\n" << "C001,D,10,30\n" << "C001,E,10,30\n";
+    seatFile << "C002,A,10,25\n" << "C002,B,10,25\n" << "C002,C,10,25\n" << "C002,D,10,25\n";
+    seatFile << "C003,A,10,25\n" << "C003,B,10,25\n" << "C003,C,10,25\n";
+    seatFile.close();
+    return true;
+}
+
+/**
+ * Function to load the seat map of every court from SeatMap.txt
+ * @param context The ticketing session
+ */
+void loadSeatMaps(TicketingContext& context) {
+    INSTRUMENT_FILE_SCOPE("loadSeatMaps");
+    context.seatHolds.clear();
+    context.courtSeatMaps.clear();
+    ifstream seatFile("SeatMap.txt");
+    if (!seatFile) {
+        if (!createSeatMapFile()) {
+            return;
+        }
+        seatFile.open("SeatMap.txt");
+    }
+
+    string line;
+    while (getline(seatFile, line)) {
+        if (line.empty()) continue;
+        stringstream ss(line);
+        string courtID, section, rows, seatsPerRow;
+        getline(ss, courtID, ',');
+        getline(ss, section, ',');
+        getline(ss, rows, ',');
+        getline(ss, seatsPerRow, ',');
+        try {
+            if (context.courtSeatMaps.find(courtID) == context.courtSeatMaps.end()) {
+                context.courtSeatMaps[courtID] = CourtSeatMap(courtID);
+            }
+            context.courtSeatMaps[courtID].addSection(section, stoi(rows), stoi(seatsPerRow));
+        } catch (const exception&) {
+            cout << "Skipping invalid seat map line: " << line << "\n";
+        }
+    }
+    seatFile.close();
+}
+
+/**
+ * Function to allocate real seats on a court for a party
+ * @param context The ticketing session
+ * @param courtID The ID of the court
+ * @param seats The number of seats in the party
+ * @param seatLabels Output: the readable seat labels
+ * @return The allocated seat blocks, empty if the party cannot be seated
+ */
+vector<SeatBlock> allocateSeats(TicketingContext& context, const string& courtID, int seats, string& seatLabels) {
+    auto it = context.courtSeatMaps.find(courtID);
+    if (it == context.courtSeatMaps.end()) {
+        return vector<SeatBlock>();
+    }
+    vector<SeatBlock> blocks = it -> second.allocate(seats);
+    seatLabels = it -> second.describe(blocks);
+    return blocks;
+}
+
+/**
+ * Function to validate if a match time is inside the ticketing window
+ * @param context The ticketing session
+ * @param dateTime The match time to validate
+ * @return True if the time is inside the window, else False
+ */
+bool isWithinTicketingWindow(const TicketingContext& context, MatchTime dateTime) {
+    return context.ticketableMatches.inWindow(dateTime);
+}
+
+/**
+ * Function to set the ticketing window from two dates
+ * @param context The ticketing session
+ * @param fromDate The first date (DD-MM-YYYY)
+ * @param toDate The last date (DD-MM-YYYY), inclusive
+ * @return True if both dates are valid, else False
+ */
+bool setTicketingWindow(TicketingContext& context, const string& fromDate, const string& toDate) {
+    MatchTime from = parseMatchTime(fromDate);
+    MatchTime to = parseMatchTime(toDate);
+    if (from < 0 || to < 0 || to < from) {
+        return false;
+    }
+    context.ticketableMatches.setWindow(from, to + 1439); // Include the whole last day
+    return true;
+}
+
+/**
+ * Function to read match data from Matches.txt into a linked list
+ * @param filename The matches file
+ * @param windowStart The first match time that is sold
+ * @param windowEnd The last match time that is sold
+ * @param matchCount The number of valid matches
+ * @return The head of the linked list of matches
+ */
+Match* readMatchesFromFile(const string& filename, MatchTime windowStart, MatchTime windowEnd, int& matchCount) {
+    INSTRUMENT_FILE_SCOPE("readMatchesFromFile");
+    // Head of the linked list of matches
+    Match* head = nullptr;
+    // Tail of the linked list for insertion
+    Match* tail = nullptr;
+    // Counter for the number of valid matches
+    matchCount = 0;
+
+    syncFile(filename);
+    ifstream inFile(filename); // Open Matches.txt file
+    // Error handling if the file cannot be opened
+    if (!inFile) {
+        cout << "Error: could not open Matches.txt. Using default matches.\n";
+        return nullptr; // Return nullptr
+    }
+
+    string line;
+    // Read each line from the file
+    while (getline(inFile, line)) {
+        // Use stringstream to parse the line
+        stringstream ss(line);
+        string matchID, stageID, roundID, p1ID, p2ID, dateTime, matchStatus, courtID;
+        // Extract each entity from the line and separated with commas
+        getline(ss, matchID, ',');
+        getline(ss, stageID, ',');
+        getline(ss, roundID, ',');
+        getline(ss, p1ID, ',');
+        getline(ss, p2ID, ',');
+        getline(ss, dateTime, ',');
+        getline(ss, matchStatus, ',');
+        getline(ss, courtID, ',');
+
+        // Trimming whitespace if necessary
+        matchID.erase(0, matchID.find_first_not_of(" \t"));
+        matchID.erase(matchID.find_last_not_of(" \t") + 1);
+
+        stageID.erase(0, stageID.find_first_not_of(" \t"));
+        stageID.erase(stageID.find_last_not_of(" \t") + 1);
+
+        roundID.erase(0, roundID.find_first_not_of(" \t"));
+        roundID.erase(roundID.find_last_not_of(" \t") + 1);
+
+        p1ID.erase(0, p1ID.find_first_not_of(" \t"));
+        p1ID.erase(p1ID.find_last_not_of(" \t") + 1);
+
+        p2ID.erase(0, p2ID.find_first_not_of(" \t"));
+        p2ID.erase(p2ID.find_last_not_of(" \t") + 1);
+
+        dateTime.erase(0, dateTime.find_first_not_of(" \t"));
+        dateTime.erase(dateTime.find_last_not_of(" \t") + 1);
+
+        matchStatus.erase(0, matchStatus.find_first_not_of(" \t"));
+        matchStatus.erase(matchStatus.find_last_not_of(" \t") + 1);
+
+        courtID.erase(0, courtID.find_first_not_of(" \t"));
+        courtID.erase(courtID.find_last_not_of(" \t") + 1);
+
+        // Validate the match date
+        MatchTime matchTime = parseMatchTime(dateTime);
+        if (matchTime < windowStart || matchTime > windowEnd) {
+            LOG_EVENT(LOG_INFO, "match.outsideWindow", "The matched " << matchID << " is not inside the ticketing window.\n", {"matchID", matchID});
+            continue; // Skip the matches outside the ticketing window
+        }
+
+        // Validate the match status
+        if (matchStatus != "waiting") {
+            LOG_EVENT(LOG_INFO, "match.notWaiting",
+                      "The matched " << matchID << " status is " << matchStatus << ". Only waiting matches are available for ticket purchase.\n",
+                      {"matchID", matchID}, {"status", matchStatus});
+            continue; // Skip the matches that are not in waiting
+        }
+
+        // Create a new match node
+        Match* newMatch = new Match{matchID, stageID, roundID, p1ID, p2ID, matchTime, matchStatus, courtID, nullptr};
+        // Check if the list is empty
+        if (head == nullptr) { 
+            head = newMatch; // Set the head and tail to the new match
+            tail = newMatch;
+        } 
+        // Append to the tail
+        else {
+            tail->next = newMatch;
+            tail = newMatch;
+        }
+        matchCount++; // Increment the match count
+    }
+    inFile.close();
+
+    if (matchCount == 0) {
+        return nullptr; // Return nullptr if no valid matches found
+    }
+
+    return head; // Return the head of the linked list
+}
+
+/**
+ * Function to format a sequential ID e.g. T001 TKS012
+ * Numbers past 999 keep all their digits (T1000)
+ * @param prefix The ID prefix
+ * @param number The sequence number
+ * @return The ID
+ */
+string formatTicketingID(const string& prefix, int number) {
+    string digits = to_string(number);
+    return prefix + string(digits.length() < 3 ? 3 - digits.length() : 0, '0') + digits;
+}
+
+// Function to format one sales record as a line of Sales.txt
+static string formatSalesLine(const SalesRecord* record) {
+    return record->salesID + "," + record->spectatorName + "," + to_string(record->ticketsQuantity) + "," + record->ticketType + "," + record->ticketID + "," + record->purchasedDateTime + "," + record->status + "\n";
+}
+
+/**
+ * Function to write the sales records into Sales.txt (written by the background writer)
+ * @param context The ticketing session
+ * @return The handle of the write
+ */
+static WriteHandle writeSalesFile(const TicketingContext& context) {
+    string contents;
+    SalesRecord* current = context.salesRecordList; // Start from the head of the list
+    // Write each record into the Sales.txt
+    while (current != nullptr) {
+        contents += formatSalesLine(current);
+        current = current->next; // Move to the next sales record
+    }
+    return AsyncFileWriter::instance().rewrite("Sales.txt", move(contents));
+}
+
+/**
+ * Function to add a sales record to the list and write into Sales.txt
+ * Sales IDs come from a counter, so the record goes at the tail and its line is appended to the file.
+ * @param context The ticketing session
+ * @param spectator The spectator to add
+ * @param status The status of the sales record (Purchased/Rejected)
+ */
+void addToSalesRecord(TicketingContext& context, Spectator* spectator, const string& status) {
+    INSTRUMENT_FILE_SCOPE("addToSalesRecord");
+    SalesRecord* newRecord = new SalesRecord; // Create a new sales record
+
+    // Generating a unique salesID e.g. TKS001 TKS002
+    newRecord -> salesID = formatTicketingID("TKS", context.salesCounter);
+    newRecord -> spectatorName = spectator -> name; // Set the spectator name
+    newRecord -> ticketsQuantity = spectator -> seatsQuantity; // Set the number of tickets
+    newRecord -> ticketType = spectator -> ticketType; // Set the ticket type
+    newRecord -> ticketID = spectator -> ticketID; // Set the ticketID
+    // Get current date and time when purchasing
+    time_t now = time(0);
+    struct tm* timeinfo = localtime(&now);
+    char buffer[20];
+    strftime(buffer, sizeof(buffer), "%d-%m-%Y %H:%M:%S", timeinfo);
+    newRecord -> purchasedDateTime = string(buffer); // Set the purchase date and time
+    newRecord -> status = status; // Set the status Purchased/Rejected
+    newRecord -> next = nullptr; // Move to the next pointer
+    context.salesAnalytics.record(spectator, status, now); // Update the live aggregates
+
+    // Append to salesRecordList; the counter only grows, so the list stays in sale order
+    bool firstRecord = context.salesRecordList == nullptr;
+    if (firstRecord) {
+        context.salesRecordList = newRecord;
+    } else {
+        context.salesRecordTail -> next = newRecord;
+    }
+    context.salesRecordTail = newRecord;
+    context.salesCounter++; // Increment the sales counter
+
+    EventLog::instance().append(TicketSoldEvent{spectator -> ticketID, spectator -> name, spectator -> ticketType, spectator -> courtID,
+                                                spectator -> matchID, spectator -> seatsQuantity, status, spectator -> seatLabels});
+    // The first record of a session replaces whatever an earlier session left in the file
+    if (firstRecord) {
+        AsyncFileWriter::instance().rewrite("Sales.txt", formatSalesLine(newRecord));
+    } else {
+        AsyncFileWriter::instance().append("Sales.txt", formatSalesLine(newRecord));
+    }
+}
+
+// Function to view the sales records from text file
+void viewSalesRecord() {
+    INSTRUMENT_FILE_SCOPE("viewSalesRecord");
+    syncFile("Sales.txt");
+    ifstream inFile("Sales.txt"); // Open the Sales.txt file and read
+    // If the file cannot open
+    if (!inFile) {
+        cout << "No sales records found.\n";
+        return;
+    }
+    cout << "\n================================= Sales Records =====================================\n";
+    cout << left << setw(10) << "SalesID" << setw(15) << "Spectator Name"
+        << setw(10) << "Quantity" << setw(12) << "Ticket Type"
+        << setw(10) << "Ticket ID" << setw(22) << "Purchase Date & Time"
+        << setw(12) << "Status" << "\n";
+    cout << "=====================================================================================\n";
+    string line;
+    // Read and display each line
+    while (getline(inFile, line)) {
+        stringstream ss(line);
+        string salesID, name, quantity, ticketType, ticketID, purchaseDateTime, status;
+        getline(ss, salesID, ',');
+        getline(ss, name, ',');
+        getline(ss, quantity, ',');
+        getline(ss, ticketType, ',');
+        getline(ss, ticketID, ',');
+        getline(ss, purchaseDateTime, ',');
+        getline(ss, status, ',');
+
+        cout << left << setw(10) << salesID << setw(15) << name
+            << setw(10) << quantity << setw(12) << ticketType
+            << setw(10) << ticketID << setw(22) << purchaseDateTime
+            << setw(12) << status << "\n";
+    }
+    inFile.close(); // Close Sales.txt
+}
+
+/**
+ * Function to set the priority based on the ticket type
+ * @param ticketType The type of the ticket
+ * @return The priority value
+ */
+int getPriority(const string& ticketType) {
+    if (ticketType == "VIP") {
+        return VIP_PRIORITY;
+    } 
+    else if (ticketType == "Early-bird") {
+        return EARLY_BIRD_PRIORITY;
+    } 
+    else {
+        return GENERAL_PRIORITY;
+    }
+}
+
+/**
+ * Function to hold seats for a spectator and add them to the ticket queue
+ * @param context The ticketing session
+ * @param name The spectator name
+ * @param ticketType VIP, Early-bird or General
+ * @param match The ticketable match
+ * @param seats The number of seats in the party
+ * @return The queued spectator, or nullptr if the party cannot be seated on the match's court
+ */
+Spectator* enqueueSpectator(TicketingContext& context, const string& name, const string& ticketType, const Match& match, int seats) {
+    // Hold the seats now so the spectator is not rejected after waiting in the queue
+    uint64_t holdID = context.seatHolds.place(match.courtID, seats);
+    if (holdID == NO_HOLD) {
+        return nullptr;
+    }
+    Spectator* spectator = new Spectator{name, ticketType, 0, "", match.courtID, seats, match.matchID, formatMatchTime(match.dateTime), nullptr, {0}, {}, "", holdID};
+    spectator -> priority = getPriority(spectator -> ticketType); // Set the priority
+    enqueuePriorityQueue(context, spectator); // Add the spectator to priority queue
+    return spectator;
+}
+
+/**
+ * Function to process the entire ticket queue in priority order and assign ticketID
+ * @param context The ticketing session
+ */
+void processTicketQueue(TicketingContext& context) {
+    INSTRUMENT_SCOPE("processTicketQueue");
+    // Check if the queue is empty
+    if (isPriorityQueueEmpty(context)) {
+        LOG_EVENT(LOG_INFO, "ticketQueue.empty", "\nNo spectators in the queue to process.\n");
+        return;
+    }
+
+    LOG_EVENT(LOG_INFO, "ticketQueue.start", "\nProcessing ticket queue...\n");
+    // Process each spectator in the queue
+    while (!isPriorityQueueEmpty(context)) {
+        Spectator* s = dequeuePriorityQueue(context); // Get the highest priority spectator
+        int courtCapacity = getCourtCapacity(context, s -> courtID); // Get the current capacity of the court
+        // Check if the court has enough capacity, then confirm the held seats
+        if (courtCapacity >= s -> seatsQuantity) {
+            if (context.seatHolds.confirm(s -> holdID, s -> seatBlocks)) {
+                s -> seatLabels = context.courtSeatMaps[s -> courtID].describe(s -> seatBlocks);
+            } else {
+                // The hold expired while waiting, try to seat the party again
+                s -> seatBlocks = allocateSeats(context, s -> courtID, s -> seatsQuantity, s -> seatLabels);
+            }
+        } else {
+            context.seatHolds.release(s -> holdID);
+        }
+        s -> holdID = NO_HOLD;
+        if (courtCapacity >= s -> seatsQuantity && !s -> seatBlocks.empty()) {
+            // Generate a unique ticketID e.g. T001 T002
+            s -> ticketID = formatTicketingID("T", context.ticketCounter);
+            context.ticketCounter++; // Increment the ticket counter
+
+            // Display the ticket purchase details
+            LOG_EVENT(LOG_INFO, "ticket.purchased",
+                      "Ticket purchased: TicketID: " << s -> ticketID
+                        << ", Name: " << s -> name
+                        << ", Type: " << s -> ticketType
+                        << ", Court: " << s -> courtID
+                        << ", Match: " << s -> matchID
+                        << ", DateTime: " << s -> dateTime
+                        << ", Seats: " << s -> seatsQuantity
+                        << " (" << s -> seatLabels << ")\n",
+                      {"ticketID", s -> ticketID}, {"courtID", s -> courtID}, {"matchID", s -> matchID},
+                      {"seats", to_string(s -> seatsQuantity)});
+            // Update the court capacity
+            updateCourtCapacity(context, s -> courtID, s -> seatsQuantity, true);
+            // Add the spectator to the spectator list
+            addToSpectatorList(context, s);
+            // Record the sales status as Purchased
+            addToSalesRecord(context, s, "Purchased");
+            INSTRUMENT_COUNT("tickets purchased", 1);
+        } 
+        // If the court capacity is exceeded
+        else {
+            LOG_EVENT(LOG_WARN, "ticket.rejected", "Court capacity exceeded. Cannot sell ticket to " << s -> name << " on court " << s -> courtID << "\n",
+                      {"courtID", s -> courtID}, {"matchID", s -> matchID}, {"seats", to_string(s -> seatsQuantity)});
+            // ticketID for rejected record
+            s -> ticketID = formatTicketingID("T", context.ticketCounter);
+            context.ticketCounter++;
+            // Record the sales status as Rejected
+            addToSalesRecord(context, s, "Rejected");
+            INSTRUMENT_COUNT("tickets rejected", 1);
+            // Free the memory of the rejected spectator
+            delete s;
+        }
+    }
+}
+
+/**
+ * Function to enqueue a gate request
+ * @param context The ticketing session
+ * @param ticketID The ticketID of the spectator
+ * @param isEntry True: Entry, False: Exit
+ */
+void enqueueGateRequest(TicketingContext& context, const string& ticketID, bool isEntry) {
+    // Create a new gate request
+    GateRequest* newRequest = new GateRequest{ticketID, isEntry, nullptr};
+    // Check if the queue is empty
+    if (context.gateRequestRear == nullptr) {
+        // Set both front and rear to the new request
+        context.gateRequestFront = context.gateRequestRear = newRequest;
+    } 
+    // Append to the rear
+    else {
+        context.gateRequestRear -> next = newRequest;
+        context.gateRequestRear = newRequest;
+    }
+}
+
+/**
+ * Function to dequeue a gate request
+ * @param context The ticketing session
+ * @return The gate request
+ */
+GateRequest* dequeueGateRequest(TicketingContext& context) {
+    // Check if the queue is empty
+    if (context.gateRequestFront == nullptr) {
+        return nullptr; // Return nullptr
+    }
+    GateRequest* temp = context.gateRequestFront; // To store the front request temporarily
+    context.gateRequestFront = context.gateRequestFront -> next; // Move the front to the next request
+    // If the queue becomes empty
+    if (context.gateRequestFront == nullptr) {
+        context.gateRequestRear = nullptr; // Reset the rear
+    }
+    temp -> next = nullptr;
+    return temp;
+}
+
+// Function to check if the gate request is empty
+bool isGateRequestQueueEmpty(const TicketingContext& context) {
+    return context.gateRequestFront == nullptr; // True: Queue is empty
+}
+
+/**
+ * Function to handle entry or exit court gates requests through different gates
+ * @param context The ticketing session
+ */
+void processGateRequests(TicketingContext& context) {
+    INSTRUMENT_SCOPE("processGateRequests");
+    // Process each gate request in the queue
+    while (!isGateRequestQueueEmpty(context)) {
+        GateRequest* request = dequeueGateRequest(context); // Dequeue the next request
+        INSTRUMENT_COUNT("gate requests", 1);
+        // Check if the request is empty and skip to the next
+        if (request == nullptr) {
+            continue;
+        }
+
+        // Find the ticketID 
+        Spectator* spectator = searchByTicketID(context, request -> ticketID);
+        // Check if the spectator is not found
+        if (spectator == nullptr) {
+            LOG_EVENT(LOG_WARN, "gate.unknownTicket", "TicketID " << request -> ticketID << " is not found.\n", {"ticketID", request -> ticketID});
+            delete request; // Free the memory of the request
+            continue;
+        }
+
+        // Check if the request is for entry
+        if (request -> isEntry) {
+            int remainingSeats = spectator -> seatsQuantity; // Total seats to assign
+            int seatsPerGate = MAX_GATE_CAPACITY; // Maximum seats per gate
+            int totalSeatsAssigned = 0; // Track teh total seats assigned
+            int gateIndex = 0; // Start from the first gate
+
+            // Initialize the gate seats array for the spectators
+            for (int i = 0; i < NUM_GATES; i++) {
+                spectator -> gateSeats[i] = 0;
+            }
+
+            // Cycle progress tracking
+            bool madeProgress = true;
+            // Track the number pf full cycles through gates
+            int cyclesCompleted = 0;
+
+            // Assign the capacity to gates until all spectators are assigned
+            while (remainingSeats > 0 && cyclesCompleted < 2) {
+                // Get the current gate from array
+                char gate = context.gateNames[gateIndex]; 
+                // Determine capacity ans assign to corresponding gate
+                int seatsToAssign = min(remainingSeats, seatsPerGate); 
+
+                // Check if the gate can be accommodated 
+                if (context.gateStacks[gateIndex].size + seatsToAssign <= MAX_GATE_CAPACITY) {
+                    // Push the spectator into the gate stack
+                    context.gateStacks[gateIndex].push(spectator, seatsToAssign);
+                    LOG_EVENT(LOG_INFO, "gate.entry", "\nTicket buyer " << spectator->name << " enters through gate " << gate << " with " << seatsToAssign << " seats.\n",
+                              {"ticketID", spectator -> ticketID}, {"gate", string(1, gate)}, {"seats", to_string(seatsToAssign)});
+                    // Record the spectators assigned to this gate
+                    spectator -> gateSeats[gateIndex] = seatsToAssign;
+                    // Update the total capacity
+                    totalSeatsAssigned += seatsToAssign;
+                    // Decrease the remaining seats
+                    remainingSeats -= seatsToAssign;
+                    // Progress tracking
+                    madeProgress = true;
+                } 
+                // Check if the gate cannot be accommodated
+                else {
+                    LOG_EVENT(LOG_INFO, "gate.full", "\nGate " << gate << " cannot accommodate " << seatsToAssign << " seats. Trying the next gate...\n",
+                              {"gate", string(1, gate)}, {"seats", to_string(seatsToAssign)});
+                }
+                gateIndex = (gateIndex + 1) % NUM_GATES; // Move to the next gate
+
+                // Check if a full cycle through gates is completed
+                if (gateIndex == 0) {
+                    cyclesCompleted++; // Increment by the cycle count
+                    // Check if no progress was made in the cycle
+                    if (!madeProgress) {
+                        LOG_EVENT(LOG_WARN, "gate.allFull",
+                                  "\nAll gates are full. Could not process remaining " << remainingSeats << " seats for " << spectator->name << ".\n",
+                                  {"ticketID", spectator -> ticketID}, {"seats", to_string(remainingSeats)});
+                        break;
+                    }
+                    madeProgress = false; // Reset the progress tracking flag for the next cycle
+                }
+            }
+            // Check if any seats are assigned
+            if (totalSeatsAssigned > 0) {
+                // Update the court capacity
+                updateCourtCapacity(context, spectator -> courtID, totalSeatsAssigned, true, false);
+                EventLog::instance().append(GatePassedEvent{spectator -> ticketID, spectator -> courtID, true, totalSeatsAssigned,
+                                                            vector<int>(spectator -> gateSeats, spectator -> gateSeats + NUM_GATES)});
+            }
+        } 
+        // If the request is for exit
+        else {
+            bool hasEntered = false; // Flag to check the spectator entered
+            // Check all gates
+            for (int i = 0; i < NUM_GATES; i++) {
+                if (spectator -> gateSeats[i] > 0) { // If the spectator has seats in any gate
+                    hasEntered = true;
+                    break;
+                }
+            }
+
+            // If the spectator has not entered
+            if (!hasEntered) {
+                LOG_EVENT(LOG_WARN, "gate.noEntry", "\nNo entry record found for " << spectator -> name << ". Cannot process exit request.\n",
+                          {"ticketID", spectator -> ticketID});
+                // Free the memory of the exit request
+                delete request;
+                continue;
+            }
+
+            // Process the exit for each gate 
+            for (int gateIndex = 0; gateIndex < NUM_GATES; gateIndex++) {
+                int seatsAssigned = spectator -> gateSeats[gateIndex];
+                // Check if the spectator has seats in this gate
+                if (seatsAssigned > 0) {
+                    char gate = context.gateNames[gateIndex]; // Get the gate character
+                    context.gateStacks[gateIndex].pop(seatsAssigned); // Pop the spectator from the gate stack
+                    LOG_EVENT(LOG_INFO, "gate.exit", "\nTicket buyer " << spectator -> name << " exits through gate " << gate << " with " << seatsAssigned << " seats.\n",
+                              {"ticketID", spectator -> ticketID}, {"gate", string(1, gate)}, {"seats", to_string(seatsAssigned)});
+                }
+            }
+            // Update the court capacity
+            updateCourtCapacity(context, spectator -> courtID, spectator -> seatsQuantity, false, false);
+            EventLog::instance().append(GatePassedEvent{spectator -> ticketID, spectator -> courtID, false, spectator -> seatsQuantity, {}});
+            // Reset the gate seats array for the spectator
+            for (int i = 0; i < NUM_GATES; i++) {
+                spectator -> gateSeats[i] = 0;
+            }
+        }
+        // Free the memory of the processed request
+        delete request;
+    }
+}
+
+/**
+ * Function to sell one ticket request straight away
+ * The ticket queue must hold no other requests, so this request is the next one processed.
+ * @param context The ticketing session
+ * @param name The spectator name
+ * @param ticketType VIP, Early-bird or General
+ * @param match The ticketable match
+ * @param seats The party size
+ * @return The ticket holder, or nullptr if the request was rejected
+ */
+Spectator* sellTicket(TicketingContext& context, const string& name, const string& ticketType, const Match& match, int seats) {
+    if (enqueueSpectator(context, name, ticketType, match, seats) == nullptr) {
+        return nullptr;
+    }
+    string ticketID = formatTicketingID("T", context.ticketCounter);
+    processTicketQueue(context);
+    return searchByTicketID(context, ticketID);
+}
+
+// Function to count the seats a ticket holder has inside the gates
+static int seatsInside(const Spectator* spectator) {
+    int seats = 0;
+    for (int i = 0; i < NUM_GATES; i++) {
+        seats += spectator -> gateSeats[i];
+    }
+    return seats;
+}
+
+/**
+ * Function to pass one ticket holder through the gates straight away
+ * @param context The ticketing session, with no other gate requests waiting
+ * @param ticketID The ticketID of the spectator
+ * @param isEntry True: Entry, False: Exit
+ * @return True if the holder got in (entry) or out (exit), False if the request was refused
+ */
+bool passThroughGate(TicketingContext& context, const string& ticketID, bool isEntry) {
+    Spectator* spectator = searchByTicketID(context, ticketID);
+    if (spectator == nullptr) {
+        return false;
+    }
+    bool wasInside = seatsInside(spectator) > 0;
+    enqueueGateRequest(context, ticketID, isEntry);
+    processGateRequests(context);
+    bool isInside = seatsInside(spectator) > 0;
+    return isEntry ? isInside : wasInside && !isInside;
+}
+
+/**
+ * Function to rebuild a fresh ticketing session from a state replayed from the event log
+ * Purchased parties are seated again in sale order, so their seat labels can differ from the original sale.
+ * @param context The ticketing session, with its seat maps loaded and no sales yet
+ * @param state The replayed state
+ */
+void restoreTicketing(TicketingContext& context, const TournamentState& state) {
+    INSTRUMENT_SCOPE("restoreTicketing");
+    // Court capacities are the defaults less what the sales and gate passes took
+    for (int i = 0; i < NUM_COURTS; i++) {
+        context.courts[i] = DEFAULT_COURTS[i];
+        auto taken = state.seatsTaken.find(DEFAULT_COURTS[i].courtID);
+        if (taken != state.seatsTaken.end()) {
+            context.courts[i].capacity -= taken -> second;
+        }
+    }
+
+    SalesRecord*& tail = context.salesRecordTail;
+    for (const TicketEntry& ticket : state.tickets) {
+        Spectator* s = new Spectator();
+        s -> name = ticket.sale.name;
+        s -> ticketType = ticket.sale.ticketType;
+        s -> priority = getPriority(ticket.sale.ticketType);
+        s -> ticketID = ticket.sale.ticketID;
+        s -> courtID = ticket.sale.courtID;
+        s -> seatsQuantity = ticket.sale.seats;
+        s -> matchID = ticket.sale.matchID;
+        s -> next = nullptr;
+        s -> holdID = NO_HOLD;
+
+        // Sales records are rebuilt in sale order, which is also salesID order
+        SalesRecord* record = new SalesRecord;
+        record -> salesID = formatTicketingID("TKS", context.salesCounter);
+        record -> spectatorName = s -> name;
+        record -> ticketsQuantity = s -> seatsQuantity;
+        record -> ticketType = s -> ticketType;
+        record -> ticketID = s -> ticketID;
+        time_t soldAt = ticket.soldAt;
+        char buffer[20];
+        strftime(buffer, sizeof(buffer), "%d-%m-%Y %H:%M:%S", localtime(&soldAt));
+        record -> purchasedDateTime = string(buffer);
+        record -> status = ticket.sale.status;
+        record -> next = nullptr;
+        if (tail == nullptr) {
+            context.salesRecordList = record;
+        } else {
+            tail -> next = record;
+        }
+        tail = record;
+        context.salesCounter++;
+        context.salesAnalytics.record(s, ticket.sale.status, soldAt);
+
+        if (ticket.sale.status != "Purchased") {
+            delete s;
+            continue;
+        }
+        s -> seatBlocks = allocateSeats(context, s -> courtID, s -> seatsQuantity, s -> seatLabels);
+        addToSpectatorList(context, s);
+        // Spectators inside the court are back on their gate stacks
+        for (int i = 0; i < NUM_GATES && i < (int)ticket.gateSeats.size(); i++) {
+            s -> gateSeats[i] = ticket.gateSeats[i];
+            if (ticket.gateSeats[i] > 0) {
+                context.gateStacks[i].push(s, ticket.gateSeats[i]);
+            }
+        }
+    }
+    context.ticketCounter = state.tickets.size() + 1;
+    writeSalesFile(context);
+}
+
+/** ---- CourtSeatMap ---- */
+
+int CourtSeatMap::findRunInRow(int row, int count) const {
+    int words = (rowLength[row] + 63) / 64;
+    int run = 0;
+    int start = 0;
+    for (int w = 0; w < words; w++) {
+        uint64_t word = freeBits[rowOffset[row] + w];
+        // Whole word is free, extend the current run by 64 seats
+        if (word == ~0ULL) {
+            if (run == 0) start = w * 64;
+            run += 64;
+            if (run >= count) return start;
+            continue;
+        }
+        int bit = 0;
+        while (bit < 64) {
+            uint64_t rest = word >> bit;
+            if (rest == 0) {
+                run = 0;
+                break;
+            }
+            if (rest & 1ULL) {
+                // Count the free seats starting at this bit
+                int ones = __builtin_ctzll(~rest);
+                if (run == 0) start = w * 64 + bit;
+                run += ones;
+                if (run >= count) return start;
+                bit += ones;
+                // A run only carries over when it reaches the end of the word
+                if (bit < 64) run = 0;
+            } else {
+                run = 0;
+                bit += __builtin_ctzll(rest);
+            }
+        }
+    }
+    return -1;
+}
+
+void CourtSeatMap::markSeats(const SeatBlock& block, bool isFree) {
+    for (int seat = block.firstSeat; seat < block.firstSeat + block.count; seat++) {
+        uint64_t& word = freeBits[rowOffset[block.row] + seat / 64];
+        uint64_t mask = 1ULL << (seat % 64);
+        if (isFree) word |= mask;
+        else word &= ~mask;
+    }
+    int delta = isFree ? block.count : -block.count;
+    rowFree[block.row] += delta;
+    freeSeats += delta;
+}
+
+void CourtSeatMap::addSection(const string& name, int rows, int seatsPerRow) {
+    SeatSection section{name, rows, seatsPerRow, (int)rowLength.size()};
+    int sectionIndex = sections.size();
+    sections.push_back(section);
+
+    int words = (seatsPerRow + 63) / 64;
+    for (int r = 0; r < rows; r++) {
+        rowOffset.push_back(freeBits.size());
+        rowLength.push_back(seatsPerRow);
+        rowFree.push_back(seatsPerRow);
+        rowSection.push_back(sectionIndex);
+        // Set only the bits for real seats, the padding stays sold
+        for (int w = 0; w < words; w++) {
+            int seatsInWord = min(64, seatsPerRow - w * 64);
+            freeBits.push_back(seatsInWord == 64 ? ~0ULL : ((1ULL << seatsInWord) - 1));
+        }
+    }
+    totalSeats += rows * seatsPerRow;
+    freeSeats += rows * seatsPerRow;
+}
+
+vector<SeatBlock> CourtSeatMap::allocate(int count) {
+    vector<SeatBlock> blocks;
+    if (count <= 0 || count > freeSeats) {
+        return blocks;
+    }
+
+    // Skip the rows that are already sold out
+    while (firstOpenRow < (int)rowFree.size() && rowFree[firstOpenRow] == 0) {
+        firstOpenRow++;
+    }
+
+    // First choice: one block of adjacent seats in a single row
+    for (int row = firstOpenRow; row < (int)rowFree.size(); row++) {
+        if (rowFree[row] < count) continue;
+        int seat = findRunInRow(row, count);
+        if (seat != -1) {
+            blocks.push_back({row, seat, count});
+            markSeats(blocks.back(), false);
+            return blocks;
+        }
+    }
+
+    // Otherwise fill the free runs row by row until the party is seated
+    int remaining = count;
+    for (int row = firstOpenRow; row < (int)rowFree.size() && remaining > 0; row++) {
+        while (rowFree[row] > 0 && remaining > 0) {
+            int seat = findRunInRow(row, 1);
+            int run = 1;
+            while (run < remaining && seat + run < rowLength[row] &&
+                   (freeBits[rowOffset[row] + (seat + run) / 64] >> ((seat + run) % 64)) & 1ULL) {
+                run++;
+            }
+            blocks.push_back({row, seat, run});
+            markSeats(blocks.back(), false);
+            remaining -= run;
+        }
+    }
+    return blocks;
+}
+
+void CourtSeatMap::release(const vector<SeatBlock>& blocks) {
+    for (const SeatBlock& block : blocks) {
+        markSeats(block, true);
+        if (block.row < firstOpenRow) {
+            firstOpenRow = block.row;
+        }
+    }
+}
+
+string CourtSeatMap::describe(const vector<SeatBlock>& blocks) const {
+    stringstream ss;
+    for (size_t i = 0; i < blocks.size(); i++) {
+        const SeatBlock& block = blocks[i];
+        const SeatSection& section = sections[rowSection[block.row]];
+        if (i > 0) ss << " ";
+        ss << section.name << "-R" << setw(2) << setfill('0') << (block.row - section.firstRow + 1)
+            << "-S" << setw(2) << setfill('0') << (block.firstSeat + 1);
+        if (block.count > 1) {
+            ss << "..S" << setw(2) << setfill('0') << (block.firstSeat + block.count);
+        }
+    }
+    return ss.str();
+}
+
+/** ---- SeatHoldManager ---- */
+
+void SeatHoldManager::link(int index) {
+    HoldEntry& entry = entries[index];
+    long long delta = entry.expiresAt - currentTick;
+    long long when = entry.expiresAt;
+    int level = 0;
+    if (delta <= 0) {
+        when = currentTick + 1; // Already due, fire on the next tick
+    } else if (delta >= (1LL << (WHEEL_BITS * 2))) {
+        level = 2;
+        // Holds beyond the wheel range wait in the furthest slot and are re-linked
+        long long maxDelta = (1LL << (WHEEL_BITS * WHEEL_LEVELS)) - 1;
+        if (delta > maxDelta) when = currentTick + maxDelta;
+    } else if (delta >= WHEEL_SLOTS) {
+        level = 1;
+    }
+    int slot = (when >> (WHEEL_BITS * level)) & (WHEEL_SLOTS - 1);
+    entry.bucket = level * WHEEL_SLOTS + slot;
+    entry.prev = -1;
+    entry.next = buckets[entry.bucket];
+    if (entry.next != -1) entries[entry.next].prev = index;
+    buckets[entry.bucket] = index;
+}
+
+void SeatHoldManager::unlink(int index) {
+    HoldEntry& entry = entries[index];
+    if (entry.prev != -1) entries[entry.prev].next = entry.next;
+    else buckets[entry.bucket] = entry.next;
+    if (entry.next != -1) entries[entry.next].prev = entry.prev;
+    entry.prev = entry.next = -1;
+}
+
+int SeatHoldManager::detach(int bucket) {
+    int head = buckets[bucket];
+    buckets[bucket] = -1;
+    return head;
+}
+
+void SeatHoldManager::freeEntry(int index) {
+    HoldEntry& entry = entries[index];
+    entry.bucket = -1;
+    entry.seatBlocks.clear();
+    entry.generation++;
+    freeEntries.push_back(index);
+    activeHolds--;
+}
+
+void SeatHoldManager::cascade(int level) {
+    int slot = (currentTick >> (WHEEL_BITS * level)) & (WHEEL_SLOTS - 1);
+    int index = detach(level * WHEEL_SLOTS + slot);
+    while (index != -1) {
+        int next = entries[index].next;
+        link(index);
+        index = next;
+    }
+}
+
+int SeatHoldManager::resolve(uint64_t handle) const {
+    if (handle == NO_HOLD) return -1;
+    int index = (int)(handle & 0xFFFFFFFFULL) - 1;
+    uint32_t generation = (uint32_t)(handle >> 32);
+    if (index < 0 || index >= (int)entries.size()) return -1;
+    const HoldEntry& entry = entries[index];
+    if (entry.bucket == -1 || entry.generation != generation) return -1;
+    return index;
+}
+
+SeatHoldManager::SeatHoldManager(map<string, CourtSeatMap>& maps)
+    : seatMaps(&maps) {
+    clear();
+}
+
+void SeatHoldManager::clear() {
+    entries.clear();
+    freeEntries.clear();
+    for (int i = 0; i < WHEEL_LEVELS * WHEEL_SLOTS; i++) {
+        buckets[i] = -1;
+    }
+    currentTick = time(0);
+    activeHolds = 0;
+}
+
+int SeatHoldManager::advance(long long now) {
+    int expired = 0;
+    // Nothing is waiting, jump straight to the current time
+    if (activeHolds == 0) {
+        if (now > currentTick) currentTick = now;
+        return 0;
+    }
+    while (currentTick < now) {
+        currentTick++;
+        if ((currentTick & (WHEEL_SLOTS - 1)) == 0) {
+            if ((currentTick & ((1LL << (WHEEL_BITS * 2)) - 1)) == 0) {
+                cascade(2);
+            }
+            cascade(1);
+        }
+        int index = detach(currentTick & (WHEEL_SLOTS - 1));
+        while (index != -1) {
+            int next = entries[index].next;
+            HoldEntry& entry = entries[index];
+            if (entry.expiresAt <= currentTick) {
+                auto it = seatMaps -> find(entry.courtID);
+                if (it != seatMaps -> end()) {
+                    it -> second.release(entry.seatBlocks);
+                }
+                freeEntry(index);
+                expired++;
+            } else {
+                link(index);
+            }
+            index = next;
+        }
+        if (activeHolds == 0) {
+            currentTick = max(currentTick, now);
+        }
+    }
+    return expired;
+}
+
+uint64_t SeatHoldManager::place(const string& courtID, int seats, int ttlSeconds) {
+    long long now = time(0);
+    advance(now);
+
+    auto it = seatMaps -> find(courtID);
+    if (it == seatMaps -> end()) {
+        return NO_HOLD;
+    }
+    vector<SeatBlock> blocks = it -> second.allocate(seats);
+    if (blocks.empty()) {
+        return NO_HOLD;
+    }
+
+    int index;
+    if (!freeEntries.empty()) {
+        index = freeEntries.back();
+        freeEntries.pop_back();
+    } else {
+        index = entries.size();
+        entries.push_back(HoldEntry{"", {}, 0, 1, -1, -1, -1});
+    }
+    HoldEntry& entry = entries[index];
+    entry.courtID = courtID;
+    entry.seatBlocks.swap(blocks);
+    entry.expiresAt = now + ttlSeconds;
+    link(index);
+    activeHolds++;
+    return ((uint64_t)entry.generation << 32) | (uint64_t)(index + 1);
+}
+
+bool SeatHoldManager::confirm(uint64_t handle, vector<SeatBlock>& seatBlocks) {
+    advance(time(0));
+    int index = resolve(handle);
+    if (index == -1) {
+        return false;
+    }
+    unlink(index);
+    seatBlocks.swap(entries[index].seatBlocks);
+    freeEntry(index);
+    return true;
+}
+
+void SeatHoldManager::release(uint64_t handle) {
+    int index = resolve(handle);
+    if (index == -1) {
+        return;
+    }
+    unlink(index);
+    auto it = seatMaps -> find(entries[index].courtID);
+    if (it != seatMaps -> end()) {
+        it -> second.release(entries[index].seatBlocks);
+    }
+    freeEntry(index);
+}
+
+/** ---- TicketableMatchCache ---- */
+
+bool TicketableMatchCache::statFile(long long& size, long long& modified) const {
+    struct stat info;
+    if (stat(filename.c_str(), &info) != 0) {
+        return false;
+    }
+    size = info.st_size;
+#if defined(__linux__)
+    modified = (long long)info.st_mtim.tv_sec * 1000000000LL + info.st_mtim.tv_nsec;
+#else
+    modified = (long long)info.st_mtime * 1000000000LL;
+#endif
+    return true;
+}
+
+TicketableMatchCache::TicketableMatchCache(const string& file)
+    : filename(file), loaded(false), fileSize(-1), fileModified(-1) {
+    int day, month, year, hour, minute;
+    splitMatchTime(tournamentStart(), day, month, year, hour, minute);
+    windowStart = makeMatchTime(1, month, year);
+    windowEnd = (month == 12 ? makeMatchTime(1, 1, year + 1) : makeMatchTime(1, month + 1, year)) - 1;
+}
+
+void TicketableMatchCache::setWindow(MatchTime from, MatchTime to) {
+    windowStart = from;
+    windowEnd = to;
+    loaded = false;
+}
+
+bool TicketableMatchCache::refresh() {
+    syncFile(filename);
+    long long size = -1, modified = -1;
+    bool exists = statFile(size, modified);
+    if (loaded && exists && size == fileSize && modified == fileModified) {
+        return false;
+    }
+
+    matches.clear();
+    byMatchID.clear();
+    byCourt.clear();
+    loaded = true;
+    fileSize = size;
+    fileModified = modified;
+    if (!exists) {
+        return true;
+    }
+
+    int matchCount = 0;
+    Match* head = readMatchesFromFile(filename, windowStart, windowEnd, matchCount);
+    matches.reserve(matchCount);
+    while (head != nullptr) {
+        Match* temp = head;
+        head = head -> next;
+        temp -> next = nullptr;
+        int index = matches.size();
+        byMatchID[temp -> matchID] = index;
+        byCourt[temp -> courtID].push_back(index);
+        matches.push_back(*temp);
+        delete temp;
+    }
+    return true;
+}
+
+void TicketableMatchCache::invalidate() {
+    loaded = false;
+}
+
+const Match* TicketableMatchCache::find(const string& matchID) const {
+    auto it = byMatchID.find(matchID);
+    return it == byMatchID.end() ? nullptr : &matches[it -> second];
+}
+
+vector<int> TicketableMatchCache::matchesOnCourt(const string& courtID) const {
+    auto it = byCourt.find(courtID);
+    return it == byCourt.end() ? vector<int>() : it -> second;
+}
+
+/** ---- SalesAnalytics ---- */
+
+int SalesAnalytics::extendTo(long long minute) {
+    if (firstMinute == -1) {
+        firstMinute = minute;
+    }
+    // The clock never moves back for live sales, clamp if it does
+    long long index = max(minute - firstMinute, (long long)ticketPrefix.size() - 1);
+    if (index < 0) index = 0;
+    while ((long long)ticketPrefix.size() <= index) {
+        ticketPrefix.push_back(ticketPrefix.empty() ? 0 : ticketPrefix.back());
+        seatPrefix.push_back(seatPrefix.empty() ? 0 : seatPrefix.back());
+    }
+    return (int)index;
+}
+
+long long SalesAnalytics::rangeSum(const vector<long long>& prefix, long long fromMinute, long long toMinute) const {
+    if (prefix.empty() || toMinute < fromMinute) return 0;
+    long long last = (long long)prefix.size() - 1;
+    long long from = max(fromMinute - firstMinute, 0LL);
+    long long to = min(toMinute - firstMinute, last);
+    if (to < 0 || from > last || to < from) return 0;
+    return prefix[to] - (from > 0 ? prefix[from - 1] : 0);
+}
+
+void SalesAnalytics::printTotals(const string& title, const map<string, SalesTotals>& totals) const {
+    cout << "\n" << title << "\n";
+    cout << left << setw(14) << "Key" << setw(10) << "Tickets" << setw(10) << "Seats" << "Rejected\n";
+    for (const auto& entry : totals) {
+        cout << left << setw(14) << entry.first << setw(10) << entry.second.tickets
+            << setw(10) << entry.second.seats << entry.second.rejected << "\n";
+    }
+}
+
+SalesAnalytics::SalesAnalytics() {
+    clear();
+}
+
+void SalesAnalytics::clear() {
+    byCourt.clear();
+    byMatch.clear();
+    byTicketType.clear();
+    firstMinute = -1;
+    ticketPrefix.clear();
+    seatPrefix.clear();
+    purchasedCount = 0;
+    rejectedCount = 0;
+}
+
+void SalesAnalytics::record(const Spectator* spectator, const string& status, time_t when) {
+    bool purchased = (status == "Purchased");
+    SalesTotals* groups[] = {&byCourt[spectator -> courtID], &byMatch[spectator -> matchID], &byTicketType[spectator -> ticketType]};
+    for (SalesTotals* totals : groups) {
+        if (purchased) {
+            totals -> tickets++;
+            totals -> seats += spectator -> seatsQuantity;
+        } else {
+            totals -> rejected++;
+        }
+    }
+    if (!purchased) {
+        rejectedCount++;
+        return;
+    }
+    purchasedCount++;
+    int index = extendTo(when / 60);
+    ticketPrefix[index] += 1;
+    seatPrefix[index] += spectator -> seatsQuantity;
+}
+
+long long SalesAnalytics::ticketsInRange(long long fromMinute, long long toMinute) const {
+    return rangeSum(ticketPrefix, fromMinute, toMinute);
+}
+
+long long SalesAnalytics::seatsInRange(long long fromMinute, long long toMinute) const {
+    return rangeSum(seatPrefix, fromMinute, toMinute);
+}
+
+double SalesAnalytics::purchasedRejectedRatio() const {
+    return rejectedCount == 0 ? (double)purchasedCount : (double)purchasedCount / rejectedCount;
+}
+
+const SalesTotals* SalesAnalytics::courtTotals(const string& courtID) const {
+    auto it = byCourt.find(courtID);
+    return it == byCourt.end() ? nullptr : &it -> second;
+}
+
+const SalesTotals* SalesAnalytics::matchTotals(const string& matchID) const {
+    auto it = byMatch.find(matchID);
+    return it == byMatch.end() ? nullptr : &it -> second;
+}
+
+void SalesAnalytics::display() const {
+    if (purchasedCount == 0 && rejectedCount == 0) {
+        cout << "\nNo sales recorded yet.\n";
+        return;
+    }
+    cout << "\n================================= Sales Analytics ===================================\n";
+    cout << "Purchased: " << purchasedCount << ", Rejected: " << rejectedCount
+        << ", Purchased/Rejected ratio: " << formatDecimal(purchasedRejectedRatio(), 2) << "\n";
+    printTotals("By Court:", byCourt);
+    printTotals("By Match:", byMatch);
+    printTotals("By Ticket Type:", byTicketType);
+
+    long long nowMinute = time(0) / 60;
+    int windows[] = {1, 15, 60};
+    cout << "\nRecent sales:\n";
+    for (int window : windows) {
+        cout << "Last " << setw(2) << window << " min: " << ticketsInRange(nowMinute - window + 1, nowMinute)
+            << " tickets, " << seatsInRange(nowMinute - window + 1, nowMinute) << " seats\n";
+    }
+}
+
+/** ---- GateStack ---- */
+
+void GateStack::push(Spectator* spectator, int seatsToAssign) {
+    // Check if the gate capacity would be exceeded
+    if (size + seatsToAssign > MAX_GATE_CAPACITY) {
+        cout << "\nGate capacity reached. Please choose the next gate.\n";
+        return;
+    }
+    Node* newNode = new Node{ spectator, nullptr }; // Create a new node for the spectator
+    newNode -> next = top; // Push the node into the stack
+    top = newNode; 
+    size += seatsToAssign; // Increment the size by number of the seats
+}
+
+void GateStack::pop(int seatsToRemove) {
+    // If the stack is empty then do nothing
+    if (top == nullptr) {
+        return;
+    }
+    // Store the top node temporarily
+    Node* temp = top;
+    top = top -> next;      // Pop the top node
+    size -= seatsToRemove;  // Decrement the size by the number of seats
+    delete temp;            // Free the memory of the pop node
+}
+
+bool GateStack::isEmpty() {
+    return top == nullptr; // True: is empty
+}
+
+/** ---- TicketingContext ---- */
+
+TicketingContext::TicketingContext(const string& matchesFile)
+    : ticketQueueFront(nullptr), spectatorList(nullptr), seatHolds(courtSeatMaps), ticketableMatches(matchesFile),
+      salesRecordList(nullptr), salesRecordTail(nullptr), salesCounter(1), ticketCounter(1), gateRequestFront(nullptr), gateRequestRear(nullptr) {
+    for (int i = 0; i < NUM_COURTS; i++) {
+        courts[i] = DEFAULT_COURTS[i];
+    }
+    for (int i = 0; i < NUM_GATES; i++) {
+        gateNames[i] = 'A' + i;
+    }
+}
+
+TicketingContext::~TicketingContext() {
+    // Spectators still waiting in the ticket queue are owned by the queue
+    while (ticketQueueFront != nullptr) {
+        Node* temp = ticketQueueFront;
+        ticketQueueFront = ticketQueueFront -> next;
+        delete temp -> spectator;
+        delete temp;
+    }
+    // Gate stacks only point at spectators of the spectator list
+    for (int i = 0; i < NUM_GATES; i++) {
+        while (!gateStacks[i].isEmpty()) {
+            gateStacks[i].pop(0);
+        }
+    }
+    // Free the memory allocated for the spectator list
+    while (spectatorList != nullptr) {
+        Node* temp = spectatorList;
+        spectatorList = spectatorList -> next;
+        delete temp -> spectator;
+        delete temp;
+    }
+    // Free the memory allocated for the sales record list
+    while (salesRecordList != nullptr) {
+        SalesRecord* temp = salesRecordList;
+        salesRecordList = salesRecordList -> next;
+        delete temp;
+    }
+    // Free the memory allocated for gate request queue
+    while (gateRequestFront != nullptr) {
+        GateRequest* temp = gateRequestFront;
+        gateRequestFront = gateRequestFront -> next;
+        delete temp;
+    }
+}
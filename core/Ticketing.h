@@ -0,0 +1,580 @@
+#ifndef CORE_TICKETING_H
+#define CORE_TICKETING_H
+
+#include "Common.h"
+#include "Instrumentation.h"
+#include "Logger.h"
+#include "EventLog.h"
+#include "AsyncWriter.h"
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------
+ * ----------------------------------- Ticket Sales and Spectator Management --------------------------------------
+ * ----------------------------------------------------------------------------------------------------------------
+ */
+
+// Constants for Priority (used to integer value comparison)
+const int VIP_PRIORITY = 3;         // Highest Priority
+const int EARLY_BIRD_PRIORITY = 2;  // Medium Priority
+const int GENERAL_PRIORITY = 1;     // Lowest Priority
+
+// Constants for Gates
+const int MAX_GATE_CAPACITY = 20;   // Maximum capacity of per gate
+const int NUM_GATES = 6;            // For Gates A, B, C, D, E, F
+
+// State of one ticket sales session (defined after the structures it holds)
+struct TicketingContext;
+
+// Structure for a Seat Block (a run of adjacent seats in one row)
+struct SeatBlock {
+    int row;       // Row index in the court's row table
+    int firstSeat; // First seat number in the row (0-based)
+    int count;     // Number of adjacent seats
+};
+
+// Structure for a Spectator
+struct Spectator {
+    string name;
+    string ticketType;
+    int priority;
+    string ticketID;
+    string courtID;
+    int seatsQuantity;
+    string matchID;
+    string dateTime;
+    Spectator* next;
+    int gateSeats[NUM_GATES]; // Array to store seats assigned to each gate (A to F)
+    vector<SeatBlock> seatBlocks; // Seats assigned at sale time
+    string seatLabels; // Readable seat labels e.g. A-R03-S05..S08
+    uint64_t holdID; // Seat hold placed when the spectator joined the queue
+};
+
+// Structure Node for a Priority and Queue (making a queue line)
+struct Node {
+    Spectator* spectator; // Person waiting
+    Node* next; // Pointer to the next node in line
+};
+
+// Insert new spectator value based on priority (adding people in order)
+void enqueuePriorityQueue(TicketingContext& context, Spectator* spectator);
+
+// Function to remove and return the highest priority spectator from the Priority Queue
+Spectator* dequeuePriorityQueue(TicketingContext& context);
+
+// Check if the priority queue is empty
+bool isPriorityQueueEmpty(const TicketingContext& context);
+
+// Function to add the spectator to spectator list
+void addToSpectatorList(TicketingContext& context, Spectator* spectator);
+
+// Function to search for a Spectator by TicketID
+Spectator* searchByTicketID(const TicketingContext& context, const string& ticketID);
+
+// Structure for Court Capacity Management
+struct Court {
+    string courtID;
+    int capacity;
+};
+
+// Using Array to store the starting capacity of the Courts (in fixed size)
+const int NUM_COURTS = 3;
+const Court DEFAULT_COURTS[NUM_COURTS] = {
+    {"C001", 1500}, // Center Court
+    {"C002", 1000}, // Championship Court
+    {"C003", 750}   // Progression Court
+};
+
+// Function to get the current capacity of a court
+int getCourtCapacity(const TicketingContext& context, const string& courtID);
+
+// Function to update the court capacity (during entry and exit)
+void updateCourtCapacity(TicketingContext& context, const string& courtID, int seats, bool isEntry, bool showOutput = true);
+
+// Structure for a Seat Section (loaded from SeatMap.txt)
+struct SeatSection {
+    string name;
+    int rows;
+    int seatsPerRow;
+    int firstRow; // Index of the section's first row in the court's row table
+};
+
+/**
+ * Seat map of a court stored as one free-seat bitmap per row (1 = free).
+ * Each row is padded to whole 64-bit words so a party can be placed by
+ * scanning words instead of single seats.
+ */
+class CourtSeatMap {
+    private:
+        string courtID;
+        vector<SeatSection> sections;
+        vector<uint64_t> freeBits;  // Bitmap words for all rows
+        vector<int> rowOffset;      // First word of each row in freeBits
+        vector<int> rowLength;      // Seats in each row
+        vector<int> rowFree;        // Free seats left in each row
+        vector<int> rowSection;     // Section index of each row
+        int totalSeats;
+        int freeSeats;
+        int firstOpenRow;           // Rows before this one are fully sold
+
+        /**
+         * Find the first run of free seats in a row
+         * @param row The row to scan
+         * @param count The number of adjacent seats needed
+         * @return The first seat of the run, or -1 if none fits
+         */
+        int findRunInRow(int row, int count) const;
+
+        /**
+         * Mark seats in a row as sold or free
+         * @param block The seats to mark
+         * @param isFree True: release the seats, False: take the seats
+         */
+        void markSeats(const SeatBlock& block, bool isFree);
+
+    public:
+        CourtSeatMap() : totalSeats(0), freeSeats(0), firstOpenRow(0) {}
+
+        CourtSeatMap(const string& id) : courtID(id), totalSeats(0), freeSeats(0), firstOpenRow(0) {}
+
+        /**
+         * Add a section of rows to the seat map
+         * @param name The section name
+         * @param rows The number of rows in the section
+         * @param seatsPerRow The number of seats in each row
+         */
+        void addSection(const string& name, int rows, int seatsPerRow);
+
+        /**
+         * Allocate seats for a party, keeping the party together in one row when possible
+         * @param count The number of seats to allocate
+         * @return The allocated seat blocks, empty if the party cannot be seated
+         */
+        vector<SeatBlock> allocate(int count);
+
+        /**
+         * Release previously allocated seats back to the seat map
+         * @param blocks The seat blocks to release
+         */
+        void release(const vector<SeatBlock>& blocks);
+
+        /**
+         * Describe seat blocks as readable labels e.g. A-R03-S05..S08
+         * @param blocks The seat blocks to describe
+         * @return The seat labels separated by spaces
+         */
+        string describe(const vector<SeatBlock>& blocks) const;
+
+        int getFreeSeats() const { return freeSeats; }
+        int getTotalSeats() const { return totalSeats; }
+};
+
+// Create SeatMap.txt with the default layout matching the court capacities
+bool createSeatMapFile();
+
+// Function to load the seat map of every court from SeatMap.txt
+void loadSeatMaps(TicketingContext& context);
+
+// Function to allocate real seats on a court for a party
+vector<SeatBlock> allocateSeats(TicketingContext& context, const string& courtID, int seats, string& seatLabels);
+
+// Constants for Seat Holds
+const int HOLD_TTL_SECONDS = 600;   // Seats are held for 10 minutes while waiting in the queue
+const uint64_t NO_HOLD = 0;         // Hold handle of a spectator without a hold
+
+/**
+ * Temporary seat holds that expire through a hierarchical timer wheel.
+ * Level 0 has one slot per second, level 1 one slot per 64 seconds and level 2
+ * one slot per 4096 seconds; holds cascade down as their expiry gets closer.
+ * Holds live in a slab with a free list, so placing, confirming and expiring a
+ * hold never searches.
+ */
+class SeatHoldManager {
+    private:
+        static const int WHEEL_BITS = 6;
+        static const int WHEEL_SLOTS = 1 << WHEEL_BITS;
+        static const int WHEEL_LEVELS = 3;
+
+        struct HoldEntry {
+            string courtID;
+            vector<SeatBlock> seatBlocks;
+            long long expiresAt;
+            uint32_t generation; // Bumped on reuse so stale handles are rejected
+            int prev;
+            int next;
+            int bucket;          // Wheel bucket holding the entry, -1 when free
+        };
+
+        map<string, CourtSeatMap>* seatMaps;   // Seat maps the held seats belong to
+        vector<HoldEntry> entries;
+        vector<int> freeEntries;
+        int buckets[WHEEL_LEVELS * WHEEL_SLOTS];
+        long long currentTick;
+        int activeHolds;
+
+        /**
+         * Put an entry into the wheel bucket matching its expiry
+         * @param index The slab index of the entry
+         */
+        void link(int index);
+
+        /**
+         * Take an entry out of its wheel bucket
+         * @param index The slab index of the entry
+         */
+        void unlink(int index);
+
+        /**
+         * Detach a whole bucket and return the head of its list
+         * @param bucket The bucket to detach
+         */
+        int detach(int bucket);
+
+        /**
+         * Return an entry to the free list
+         * @param index The slab index of the entry
+         */
+        void freeEntry(int index);
+
+        /**
+         * Move the holds of the current higher-level slot one level down
+         * @param level The wheel level to cascade
+         */
+        void cascade(int level);
+
+        /**
+         * Find the slab index of a live hold
+         * @param handle The hold handle
+         * @return The slab index, or -1 if the hold expired or never existed
+         */
+        int resolve(uint64_t handle) const;
+
+    public:
+        SeatHoldManager(map<string, CourtSeatMap>& maps);
+
+        /**
+         * Drop all holds without releasing their seats (used when the seat maps are reloaded)
+         */
+        void clear();
+
+        /**
+         * Expire every hold due up to the given time and release its seats
+         * @param now The current time in seconds
+         * @return The number of holds expired
+         */
+        int advance(long long now);
+
+        /**
+         * Hold seats for a party until it is processed or the hold expires
+         * @param courtID The ID of the court
+         * @param seats The number of seats to hold
+         * @param ttlSeconds How long the seats are held
+         * @return The hold handle, or NO_HOLD if the party cannot be seated
+         */
+        uint64_t place(const string& courtID, int seats, int ttlSeconds = HOLD_TTL_SECONDS);
+
+        /**
+         * Turn a hold into a sale and hand over its seats
+         * @param handle The hold handle
+         * @param seatBlocks Output: the held seats
+         * @return True if the hold was still live, else False
+         */
+        bool confirm(uint64_t handle, vector<SeatBlock>& seatBlocks);
+
+        /**
+         * Cancel a hold and release its seats
+         * @param handle The hold handle
+         */
+        void release(uint64_t handle);
+
+        int getActiveHolds() const { return activeHolds; }
+};
+
+// Function to validate if a match time is inside the ticketing window
+bool isWithinTicketingWindow(const TicketingContext& context, MatchTime dateTime);
+
+// Function to set the ticketing window from two dates
+bool setTicketingWindow(TicketingContext& context, const string& fromDate, const string& toDate);
+
+// Structure for Matches
+struct Match {
+    string matchID;
+    string stageID;
+    string roundID;
+    string p1ID;
+    string p2ID;
+    MatchTime dateTime;
+    string matchStatus;
+    string courtID;
+    Match* next;
+};
+
+// Function to read match data from Matches.txt into a linked list
+Match* readMatchesFromFile(const string& filename, MatchTime windowStart, MatchTime windowEnd, int& matchCount);
+
+/**
+ * Cached, indexed view of the ticketable matches in Matches.txt.
+ * The file is only parsed again when its modification time or size changes,
+ * so a purchase looks its match up by position or matchID in O(1).
+ */
+class TicketableMatchCache {
+    private:
+        string filename;
+        MatchTime windowStart;  // Ticketing window, only matches scheduled inside it are sold
+        MatchTime windowEnd;
+        vector<Match> matches;
+        unordered_map<string, int> byMatchID;
+        unordered_map<string, vector<int>> byCourt;
+        bool loaded;
+        long long fileSize;
+        long long fileModified; // Modification time in nanoseconds where available
+
+        /**
+         * Read the size and modification time of the matches file
+         * @param size Output: the file size
+         * @param modified Output: the modification time
+         * @return True if the file exists, else False
+         */
+        bool statFile(long long& size, long long& modified) const;
+
+    public:
+        // The ticketing window defaults to the month of the tournament's first day
+        TicketableMatchCache(const string& file);
+
+        /**
+         * Set the ticketing window and refilter the matches on the next refresh
+         * @param from The first match time that is sold
+         * @param to The last match time that is sold
+         */
+        void setWindow(MatchTime from, MatchTime to);
+
+        bool inWindow(MatchTime time) const { return time >= windowStart && time <= windowEnd; }
+
+        /**
+         * Reload the ticketable matches if the file changed since the last load
+         * @return True if the cache was rebuilt, else False
+         */
+        bool refresh();
+
+        // Force the next refresh to reparse the file
+        void invalidate();
+
+        /**
+         * Find a ticketable match by ID
+         * @param matchID The ID of the match
+         * @return The match, or nullptr if it is not ticketable
+         */
+        const Match* find(const string& matchID) const;
+
+        /**
+         * Get the ticketable matches on a court
+         * @param courtID The ID of the court
+         * @return The positions of the matches in list order
+         */
+        vector<int> matchesOnCourt(const string& courtID) const;
+
+        const Match& at(int index) const { return matches[index]; }
+        int size() const { return matches.size(); }
+};
+
+// Structure for Sales Records
+struct SalesRecord {
+    string salesID;
+    string spectatorName;
+    int ticketsQuantity;
+    string ticketType;
+    string ticketID;
+    string purchasedDateTime;
+    string status;
+    SalesRecord* next;
+};
+
+// Structure for Sales Totals of one court, match or ticket type
+struct SalesTotals {
+    int tickets;    // Purchased tickets (one per spectator)
+    int seats;      // Purchased seats
+    int rejected;   // Rejected requests
+};
+
+/**
+ * Live sales aggregates built as each sales record is added.
+ * Per-minute sales are kept as prefix sums; sales only arrive at the current
+ * minute so each record extends the arrays in amortised O(1) and any minute
+ * range is answered with two lookups.
+ */
+class SalesAnalytics {
+    private:
+        map<string, SalesTotals> byCourt;
+        map<string, SalesTotals> byMatch;
+        map<string, SalesTotals> byTicketType;
+        long long firstMinute;          // Minute of the first record, -1 when empty
+        vector<long long> ticketPrefix; // ticketPrefix[i] = tickets sold up to minute firstMinute + i
+        vector<long long> seatPrefix;   // seatPrefix[i] = seats sold up to minute firstMinute + i
+        int purchasedCount;
+        int rejectedCount;
+
+        /**
+         * Extend the prefix arrays so they cover the given minute
+         * @param minute The epoch minute of the record
+         * @return The index of the minute in the prefix arrays
+         */
+        int extendTo(long long minute);
+
+        /**
+         * Sum a prefix array over a range of minutes
+         * @param prefix The prefix array
+         * @param fromMinute The first epoch minute (inclusive)
+         * @param toMinute The last epoch minute (inclusive)
+         */
+        long long rangeSum(const vector<long long>& prefix, long long fromMinute, long long toMinute) const;
+
+        /**
+         * Print one totals table
+         * @param title The title of the table
+         * @param totals The totals to print
+         */
+        void printTotals(const string& title, const map<string, SalesTotals>& totals) const;
+
+    public:
+        SalesAnalytics();
+
+        // Reset all aggregates (a new Sales.txt is started)
+        void clear();
+
+        /**
+         * Add one sales record to the aggregates
+         * @param spectator The spectator of the record
+         * @param status The status of the record (Purchased/Rejected)
+         * @param when The time of the record
+         */
+        void record(const Spectator* spectator, const string& status, time_t when);
+
+        /**
+         * Tickets sold in a range of minutes
+         * @param fromMinute The first epoch minute (inclusive)
+         * @param toMinute The last epoch minute (inclusive)
+         */
+        long long ticketsInRange(long long fromMinute, long long toMinute) const;
+
+        /**
+         * Seats sold in a range of minutes
+         * @param fromMinute The first epoch minute (inclusive)
+         * @param toMinute The last epoch minute (inclusive)
+         */
+        long long seatsInRange(long long fromMinute, long long toMinute) const;
+
+        /**
+         * Purchased to rejected ratio, or the purchased count when nothing was rejected
+         */
+        double purchasedRejectedRatio() const;
+
+        const SalesTotals* courtTotals(const string& courtID) const;
+
+        const SalesTotals* matchTotals(const string& matchID) const;
+
+        // Display the live sales analytics
+        void display() const;
+};
+
+// Function to add a sales record to the list and write into Sales.txt
+void addToSalesRecord(TicketingContext& context, Spectator* spectator, const string& status);
+
+// Function to view the sales records from text file
+void viewSalesRecord();
+
+// Function to set the priority based on the ticket type
+int getPriority(const string& ticketType);
+
+// Function to format a sequential ID e.g. T001 TKS012
+string formatTicketingID(const string& prefix, int number);
+
+// Function to hold seats for a spectator and add them to the ticket queue
+Spectator* enqueueSpectator(TicketingContext& context, const string& name, const string& ticketType, const Match& match, int seats);
+
+// Function to process the entire ticket queue in priority order and assign ticketID
+void processTicketQueue(TicketingContext& context);
+
+// Function to sell one ticket request straight away, nullptr if it was rejected
+Spectator* sellTicket(TicketingContext& context, const string& name, const string& ticketType, const Match& match, int seats);
+
+// Structure for an Entry/Exit Process
+struct GateRequest {
+    string ticketID;
+    bool isEntry; // True: Entry, False: Exit
+    GateRequest* next;
+};
+
+// Function to enqueue a gate request
+void enqueueGateRequest(TicketingContext& context, const string& ticketID, bool isEntry);
+
+// Function to dequeue a gate request
+GateRequest* dequeueGateRequest(TicketingContext& context);
+
+// Function to check if the gate request is empty
+bool isGateRequestQueueEmpty(const TicketingContext& context);
+
+// Stack for Entry/Exit at Each Gate
+struct GateStack {
+    Node* top;  // Top of the stack for the gate
+    int size;   // Represents total seats, not number of spectators
+
+    GateStack() : top(nullptr), size(0) {} // Constructor to initialize an empty stack
+
+    /**
+     * Push a spectator into the gate stack
+     * @param spectator The spectator to push
+     * @param seatsToAssign The number of seats to assign
+     */
+    void push(Spectator* spectator, int seatsToAssign);
+
+    /**
+     * Pop spectator from the gate stack and remove the number of seats with he or she
+     * @param seatsToRemove The number of seats to remove
+     */
+    void pop(int seatsToRemove);
+
+    // Check if the gate stack is empty
+    bool isEmpty();
+};
+
+/**
+ * State of one ticket sales session: the ticket queue, spectators, court capacities,
+ * seat maps and holds, sales records and gate queues. Every ticketing function works
+ * on a context passed in, so independent sessions can exist side by side.
+ */
+struct TicketingContext {
+    Node* ticketQueueFront;                     // Front of the Priority Queue
+    Node* spectatorList;                        // Head of the spectator list
+    Court courts[NUM_COURTS];                   // Remaining capacity of each court
+    map<string, CourtSeatMap> courtSeatMaps;    // Seat maps of every court, keyed by courtID
+    SeatHoldManager seatHolds;                  // Seat holds of the spectators waiting in the ticket queue
+    TicketableMatchCache ticketableMatches;     // Ticketable matches shared by every purchase
+    SalesRecord* salesRecordList;               // Head of the sales records linked list
+    SalesRecord* salesRecordTail;               // Tail of the sales records linked list
+    SalesAnalytics salesAnalytics;              // Live aggregates over the sales records
+    int salesCounter;                           // Counter for generating unique salesID
+    int ticketCounter;                          // Counter for generating unique ticketID
+    GateRequest* gateRequestFront;              // Front of the gate request queue
+    GateRequest* gateRequestRear;               // Rear of the gate request queue
+    GateStack gateStacks[NUM_GATES];            // Entry stack of each gate
+    char gateNames[NUM_GATES];                  // Gates A to F
+
+    TicketingContext(const string& matchesFile = "Matches.txt");
+
+    TicketingContext(const TicketingContext&) = delete;
+    TicketingContext& operator=(const TicketingContext&) = delete;
+
+    ~TicketingContext();
+};
+
+// Function to handle entry or exit court gates requests through different gates
+void processGateRequests(TicketingContext& context);
+
+// Function to pass one ticket holder through the gates straight away, False if the request was refused
+bool passThroughGate(TicketingContext& context, const string& ticketID, bool isEntry);
+
+// Function to rebuild a fresh ticketing session from a state replayed from the event log
+void restoreTicketing(TicketingContext& context, const TournamentState& state);
+
+
+
+#endif
@@ -0,0 +1,410 @@
+#include "Withdrawals.h"
+
+/**
+ * Read players from a file
+ * @param filename the name of the file
+ * @return a map of players
+ */
+map<string, string> readPlayersFromFile(const string& filename) {
+    INSTRUMENT_FILE_SCOPE("readPlayersFromFile");
+    syncFile(filename);
+    ifstream file(filename);
+    map<string, string> players;
+    if (!file) return players;
+
+    // Read players from the file
+    string line;
+    while (getline(file, line)) {
+        stringstream ss(line);
+        string playerId, name;
+        getline(ss, playerId, ',');
+        getline(ss, name, ',');
+        players[name] = playerId;
+    }
+    file.close();
+    return players;
+}
+
+/**
+ * Substitute withdrawn players in all their waiting matches.
+ * Each slot gets the free player of the match's stage with the closest ranking.
+ * @param playerIds The IDs of the withdrawn players.
+ * @param matchesFile The matches file.
+ * @param playersFile The players file.
+ * @return the substitutions made
+ */
+vector<Substitution> substitutePlayers(const vector<string>& playerIds, const string& matchesFile, const string& playersFile) {
+    INSTRUMENT_SCOPE("substitutePlayers");
+    SubstitutionEngine engine;
+    if (!engine.load(playersFile, matchesFile, "Withdrawals.txt")) {
+        LOG_EVENT(LOG_ERROR, "substitution.loadFailed", "Error reading player or match list.\n");
+        return {};
+    }
+
+    vector<Substitution> substitutions = engine.substitute(playerIds);
+    for (const Substitution& substitution : substitutions) {
+        if (substitution.substituteId.empty()) {
+            LOG_EVENT(LOG_WARN, "substitution.none", "No available substitute for " << substitution.withdrawnId << " in match " << substitution.matchId << ".\n",
+                      {"matchID", substitution.matchId}, {"withdrawnID", substitution.withdrawnId});
+        } else {
+            LOG_EVENT(LOG_INFO, "substitution.made",
+                      "Substituted " << substitution.withdrawnId << " with " << substitution.substituteId
+                        << " in match " << substitution.matchId << ".\n",
+                      {"matchID", substitution.matchId}, {"withdrawnID", substitution.withdrawnId}, {"substituteID", substitution.substituteId});
+        }
+    }
+
+    if (!substitutions.empty() && !engine.save(matchesFile)) {
+        LOG_EVENT(LOG_ERROR, "substitution.saveFailed", "Error: Unable to update " << matchesFile << ". No substitutions were saved.\n",
+                  {"file", matchesFile});
+        return {};
+    }
+    vector<EventPayload> events;
+    for (const Substitution& substitution : substitutions) {
+        if (!substitution.substituteId.empty()) {
+            events.push_back(PlayerSubstitutedEvent{substitution.matchId, substitution.withdrawnId, substitution.substituteId});
+        }
+    }
+    EventLog::instance().append(events);
+    LOG_EVENT(LOG_INFO, "substitution.done", "Substitution process completed.\n", {"count", to_string(substitutions.size())});
+    return substitutions;
+}
+
+/**
+ * Substitute a withdrawn player in all of their waiting matches
+ * @param playerId The ID of the withdrawn player.
+ * @param matchesFile The matches file.
+ * @param playersFile The players file.
+ */
+void substitutePlayer(const string& playerId, const string& matchesFile, const string& playersFile) {
+    INSTRUMENT_SCOPE("substitutePlayer");
+    substitutePlayers(vector<string>{playerId}, matchesFile, playersFile);
+}
+
+/**
+ * Withdraw a batch of players and substitute them in all of their waiting matches
+ * @param withdrawals the player withdrawals object
+ * @param requests the players to withdraw
+ */
+void withdrawPlayers(PlayerWithdrawals &withdrawals, const vector<WithdrawalRequest>& requests) {
+    vector<Player> recorded = withdrawals.withdrawBatch(requests);
+    vector<string> playerIds;
+    playerIds.reserve(recorded.size());
+    for (const Player& player : recorded) playerIds.push_back(player.playerId);
+
+    vector<Substitution> substitutions = substitutePlayers(playerIds, "Matches.txt", "Players.txt");
+    cout << recorded.size() << " player(s) withdrawn, " << substitutions.size() << " match slot(s) affected." << endl;
+}
+
+/** ---- PlayerWithdrawals ---- */
+
+set<string> PlayerWithdrawals::keywordsOf(const string& reason) {
+    set<string> keywords;
+    string word;
+    for (char c : reason + " ") {
+        if (isalnum((unsigned char)c)) {
+            word += (char)tolower((unsigned char)c);
+        } else if (!word.empty()) {
+            keywords.insert(word);
+            word.clear();
+        }
+    }
+    return keywords;
+}
+
+void PlayerWithdrawals::addRecord(const Player& record) {
+    int index = records.size();
+    records.push_back(record);
+    byPlayer[record.playerId].push_back(index);
+    byTime.emplace(record.time, index);
+    for (const string& keyword : keywordsOf(record.reason)) byKeyword[keyword].push_back(index);
+
+    int number = 0;
+    if (record.withdrawalId.size() > 1 && (stringstream(record.withdrawalId.substr(1)) >> number)) {
+        nextNumber = max(nextNumber, number + 1);
+    }
+}
+
+WithdrawalPage PlayerWithdrawals::pageOf(const vector<int>* positions, int page, int pageSize) const {
+    WithdrawalPage result;
+    result.total = positions ? positions -> size() : records.size();
+    int first = (max(page, 1) - 1) * pageSize;
+    for (int i = first; i < first + pageSize && i < result.total; i++) {
+        int position = result.total - 1 - i;
+        result.entries.push_back(&records[positions ? (*positions)[position] : position]);
+    }
+    return result;
+}
+
+PlayerWithdrawals::PlayerWithdrawals(const string& file)
+    : filename(file), nextNumber(1) {
+    INSTRUMENT_FILE_SCOPE("PlayerWithdrawals::load");
+    syncFile(filename);
+    ifstream in(filename);
+    string line;
+    while (getline(in, line)) {
+        if (line.empty()) continue;
+        stringstream ss(line);
+        Player record { "", "", "", "", "", nullptr };
+        getline(ss, record.withdrawalId, ',');
+        getline(ss, record.playerId, ',');
+        getline(ss, record.name, ',');
+        // The reason may contain commas, the time is after the last one
+        string rest;
+        getline(ss, rest);
+        size_t lastComma = rest.find_last_of(',');
+        if (lastComma != string::npos) {
+            record.reason = rest.substr(0, lastComma);
+            record.time = rest.substr(lastComma + 1);
+        } else {
+            record.reason = rest;
+        }
+        addRecord(record);
+    }
+}
+
+void PlayerWithdrawals::withdraw(string playerId, string name, string reason) {
+    withdrawBatch(vector<WithdrawalRequest>{WithdrawalRequest{playerId, name, reason}});
+}
+
+vector<Player> PlayerWithdrawals::withdrawBatch(const vector<WithdrawalRequest>& requests) {
+    INSTRUMENT_FILE_SCOPE("PlayerWithdrawals::withdrawBatch");
+    vector<Player> recorded;
+    if (requests.empty()) return recorded;
+
+    string currentTime = getCurrentTime();
+    string buffer;
+    recorded.reserve(requests.size());
+
+    for (const WithdrawalRequest& request : requests) {
+        stringstream idSS;
+        idSS << "W" << setfill('0') << setw(3) << nextNumber;
+        Player newPlayer { idSS.str(), request.playerId, request.name, request.reason, currentTime, nullptr };
+        addRecord(newPlayer);
+        recorded.push_back(newPlayer);
+
+        buffer += newPlayer.withdrawalId + "," + request.playerId + "," + request.name + ","
+                + request.reason + "," + currentTime + "\n";
+        LOG_EVENT(LOG_INFO, "player.withdrawn", "Player " << request.name << " has been withdrawn. Reason: " << request.reason << "\n",
+                  {"withdrawalID", newPlayer.withdrawalId}, {"playerID", request.playerId}, {"reason", request.reason});
+    }
+    LOG_EVENT(LOG_INFO, "withdrawal.batch", "========================================\n", {"count", to_string(requests.size())});
+
+    AsyncFileWriter::instance().append(filename, move(buffer));
+
+    vector<EventPayload> events;
+    events.reserve(recorded.size());
+    for (const Player& player : recorded) {
+        events.push_back(PlayerWithdrawnEvent{player.withdrawalId, player.playerId, player.name, player.reason});
+    }
+    EventLog::instance().append(events);
+    return recorded;
+}
+
+WithdrawalPage PlayerWithdrawals::recent(int page, int pageSize) const {
+    return pageOf(nullptr, page, pageSize);
+}
+
+WithdrawalPage PlayerWithdrawals::findByPlayer(const string& playerId, int page, int pageSize) const {
+    auto it = byPlayer.find(playerId);
+    if (it == byPlayer.end()) return WithdrawalPage{{}, 0};
+    return pageOf(&it -> second, page, pageSize);
+}
+
+WithdrawalPage PlayerWithdrawals::findByReason(const string& keyword, int page, int pageSize) const {
+    set<string> words = keywordsOf(keyword);
+    if (words.empty()) return WithdrawalPage{{}, 0};
+
+    // Intersect the posting lists, shortest first; positions are in file order, so each list is sorted
+    vector<const vector<int>*> postings;
+    for (const string& word : words) {
+        auto it = byKeyword.find(word);
+        if (it == byKeyword.end()) return WithdrawalPage{{}, 0};
+        postings.push_back(&it -> second);
+    }
+    sort(postings.begin(), postings.end(), [](const vector<int>* a, const vector<int>* b) {
+        return a -> size() < b -> size();
+    });
+    if (postings.size() == 1) return pageOf(postings[0], page, pageSize);
+    vector<int> matching = *postings[0];
+    for (size_t i = 1; i < postings.size() && !matching.empty(); i++) {
+        vector<int> kept;
+        set_intersection(matching.begin(), matching.end(), postings[i] -> begin(), postings[i] -> end(), back_inserter(kept));
+        matching.swap(kept);
+    }
+    return pageOf(&matching, page, pageSize);
+}
+
+WithdrawalPage PlayerWithdrawals::findByTimeWindow(const string& from, string to, int page, int pageSize) const {
+    if (to.size() == 10) to += " 23:59:59";
+    WithdrawalPage result;
+    auto begin = byTime.lower_bound(from);
+    auto end = byTime.upper_bound(to);
+    result.total = from <= to ? distance(begin, end) : 0;
+    if (result.total == 0) return result;
+    auto it = begin;
+    for (int skip = (max(page, 1) - 1) * pageSize; skip > 0 && it != end; skip--) ++it;
+    for (int count = 0; count < pageSize && it != end; count++, ++it) {
+        result.entries.push_back(&records[it -> second]);
+    }
+    return result;
+}
+
+void PlayerWithdrawals::displayPage(const WithdrawalPage& result, int page, int pageSize) {
+    if (result.total == 0) {
+        cout << "No withdrawals found." << endl;
+        return;
+    }
+    int pages = (result.total + pageSize - 1) / pageSize;
+    cout << "Withdrawn Players (page " << max(page, 1) << " of " << pages << ", " << result.total << " records):\n";
+    for (const Player* record : result.entries) {
+        cout << "Withdrawal: " << record -> withdrawalId
+            << "\nPlayer ID : " << record -> playerId
+            << "\nName      : " << record -> name
+            << "\nReason    : " << record -> reason
+            << "\nTime      : " << record -> time << endl;
+    }
+    cout << "========================================" << endl;
+}
+
+string PlayerWithdrawals::getCurrentTime() {
+    time_t now = time(0);
+    char buffer[80];
+    strftime(buffer, sizeof(buffer), "%Y-%m-%d %H:%M:%S", localtime(&now));
+    return string(buffer);
+}
+
+/** ---- SubstitutionEngine ---- */
+
+void SubstitutionEngine::markBooked(const string& playerId) {
+    auto it = playerInfo.find(playerId);
+    if (it == playerInfo.end()) return;
+    auto pool = stagePools.find(it -> second.second);
+    if (pool != stagePools.end()) pool -> second.erase(make_pair(it -> second.first, playerId));
+}
+
+string SubstitutionEngine::takeClosest(const string& stage, int ranking) {
+    auto pool = stagePools.find(stage);
+    if (pool == stagePools.end() || pool -> second.empty()) return "";
+    set<pair<int, string>>& free = pool -> second;
+    auto above = free.lower_bound(make_pair(ranking, string()));
+    auto best = above;
+    if (above == free.end() || (above != free.begin() && ranking - prev(above) -> first <= above -> first - ranking)) {
+        best = prev(above);
+    }
+    string substituteId = best -> second;
+    free.erase(best);
+    return substituteId;
+}
+
+bool SubstitutionEngine::load(const string& playersFile, const string& matchesFile, const string& withdrawalsFile) {
+    INSTRUMENT_FILE_SCOPE("SubstitutionEngine::load");
+    rows.clear();
+    waitingByPlayer.clear();
+    playerInfo.clear();
+    stagePools.clear();
+
+    syncFile(playersFile);
+    syncFile(matchesFile);
+    ifstream players(playersFile);
+    ifstream matches(matchesFile);
+    if (!players || !matches) return false;
+
+    string line;
+    while (getline(players, line)) {
+        stringstream ss(line);
+        string playerId, name, nationality, ranking, gender, stage;
+        getline(ss, playerId, ',');
+        getline(ss, name, ',');
+        getline(ss, nationality, ',');
+        getline(ss, ranking, ',');
+        getline(ss, gender, ',');
+        getline(ss, stage, ',');
+        if (playerId.empty()) continue;
+        int rank = numeric_limits<int>::max();
+        stringstream(ranking) >> rank;
+        playerInfo[playerId] = make_pair(rank, stage);
+        stagePools[stage].insert(make_pair(rank, playerId));
+    }
+
+    while (getline(matches, line)) {
+        MatchRow row;
+        row.line = line;
+        row.changed = false;
+        stringstream ss(line);
+        getline(ss, row.matchId, ',');
+        getline(ss, row.stage, ',');
+        getline(ss, row.round, ',');
+        getline(ss, row.p1Id, ',');
+        getline(ss, row.p2Id, ',');
+        getline(ss, row.scheduledTime, ',');
+        getline(ss, row.matchStatus, ',');
+        getline(ss, row.courtId, ',');
+        // Anyone in a match that is not finished is already booked
+        if (row.matchStatus != "completed") {
+            markBooked(row.p1Id);
+            markBooked(row.p2Id);
+        }
+        if (row.matchStatus == "waiting") {
+            waitingByPlayer[row.p1Id].push_back(rows.size());
+            waitingByPlayer[row.p2Id].push_back(rows.size());
+        }
+        rows.push_back(row);
+    }
+
+    syncFile(withdrawalsFile);
+    ifstream withdrawals(withdrawalsFile);
+    while (getline(withdrawals, line)) {
+        stringstream ss(line);
+        string withdrawalId, playerId;
+        getline(ss, withdrawalId, ',');
+        getline(ss, playerId, ',');
+        markBooked(playerId);
+    }
+    return true;
+}
+
+vector<Substitution> SubstitutionEngine::substitute(const vector<string>& withdrawnIds) {
+    unordered_set<string> withdrawn(withdrawnIds.begin(), withdrawnIds.end());
+    for (const string& playerId : withdrawnIds) markBooked(playerId);
+
+    // Only the rows indexed under withdrawn players are visited, in file order
+    vector<int> affected;
+    for (const string& playerId : withdrawn) {
+        auto it = waitingByPlayer.find(playerId);
+        if (it != waitingByPlayer.end()) affected.insert(affected.end(), it -> second.begin(), it -> second.end());
+    }
+    sort(affected.begin(), affected.end());
+    affected.erase(unique(affected.begin(), affected.end()), affected.end());
+
+    vector<Substitution> substitutions;
+    for (int rowIndex : affected) {
+        MatchRow& row = rows[rowIndex];
+        for (string* slot : {&row.p1Id, &row.p2Id}) {
+            if (withdrawn.count(*slot) == 0) continue;
+            auto info = playerInfo.find(*slot);
+            int ranking = info == playerInfo.end() ? 0 : info -> second.first;
+            string substituteId = takeClosest(row.stage, ranking);
+            substitutions.push_back(Substitution{row.matchId, *slot, substituteId});
+            if (substituteId.empty()) continue;
+            *slot = substituteId;
+            row.changed = true;
+        }
+    }
+    return substitutions;
+}
+
+bool SubstitutionEngine::save(const string& matchesFile) {
+    INSTRUMENT_FILE_SCOPE("SubstitutionEngine::save");
+    string contents;
+    for (const MatchRow& row : rows) {
+        if (row.changed) {
+            contents += row.matchId + ',' + row.stage + ',' + row.round + ',' + row.p1Id + ',' + row.p2Id + ','
+                        + row.scheduledTime + ',' + row.matchStatus + ',' + row.courtId + '\n';
+        } else {
+            contents += row.line + '\n';
+        }
+    }
+    // Through the background writer, so the rewrite is ordered after the writes already queued for the file
+    return AsyncFileWriter::instance().rewrite(matchesFile, move(contents)).wait();
+}
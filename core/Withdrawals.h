@@ -0,0 +1,218 @@
+#ifndef CORE_WITHDRAWALS_H
+#define CORE_WITHDRAWALS_H
+
+#include "Common.h"
+#include "Instrumentation.h"
+#include "Logger.h"
+#include "EventLog.h"
+#include "AsyncWriter.h"
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------
+ * ----------------------------------------- Handling Player Withdrawal -------------------------------------------
+ * ----------------------------------------------------------------------------------------------------------------
+ */
+// Structure for a Player
+struct Player {
+    string withdrawalId;
+    string playerId;
+    string name;
+    string reason;
+    string time;
+    Player* next;
+};
+
+// Structure for one entry of a batch withdrawal
+struct WithdrawalRequest {
+    string playerId;
+    string name;
+    string reason;
+};
+
+// One page of a withdrawal history query
+struct WithdrawalPage {
+    vector<const Player*> entries;  // Valid until the next withdrawal is recorded
+    int total;                      // Matching records over all pages
+};
+
+/**
+ * Withdrawal history loaded from Withdrawals.txt and kept in memory.
+ * Records are stored once in file order; player, time and reason keyword
+ * indexes hold record positions, so paged queries never copy the history.
+ */
+class PlayerWithdrawals {
+    private:
+        string filename;
+        vector<Player> records;
+        unordered_map<string, vector<int>> byPlayer;
+        multimap<string, int> byTime;
+        unordered_map<string, vector<int>> byKeyword;
+        int nextNumber;
+
+        /**
+         * Split a reason into lowercase keywords
+         * @param reason the reason text
+         * @return the distinct keywords
+         */
+        static set<string> keywordsOf(const string& reason);
+
+        // Add a record to the store and its indexes
+        void addRecord(const Player& record);
+
+        /**
+         * Cut one page out of a list of record positions, newest first
+         * @param positions the record positions in file order, nullptr for every record
+         * @param page the 1-based page number
+         * @param pageSize the records per page
+         */
+        WithdrawalPage pageOf(const vector<int>* positions, int page, int pageSize) const;
+
+    public:
+        /**
+         * Load the withdrawal history
+         * @param file the withdrawals file
+         */
+        PlayerWithdrawals(const string& file = "Withdrawals.txt");
+
+        /**
+         * Withdraw a player
+         * @param name the name of the player
+         * @param reason the reason for withdrawal
+         */
+        void withdraw(string playerId, string name, string reason);
+
+        /**
+         * Withdraw many players at once.
+         * IDs continue from the loaded history and all records are appended in one write.
+         * @param requests the players to withdraw
+         * @return the recorded withdrawals
+         */
+        vector<Player> withdrawBatch(const vector<WithdrawalRequest>& requests);
+
+        int size() const { return records.size(); }
+
+        /**
+         * Get a page of all withdrawals, newest first
+         * @param page the 1-based page number
+         * @param pageSize the records per page
+         */
+        WithdrawalPage recent(int page, int pageSize) const;
+
+        /**
+         * Get a page of one player's withdrawals, newest first
+         * @param playerId the player ID
+         * @param page the 1-based page number
+         * @param pageSize the records per page
+         */
+        WithdrawalPage findByPlayer(const string& playerId, int page, int pageSize) const;
+
+        /**
+         * Get a page of the withdrawals whose reason contains every word of a query, newest first
+         * @param keyword the keywords (case-insensitive whole words)
+         * @param page the 1-based page number
+         * @param pageSize the records per page
+         */
+        WithdrawalPage findByReason(const string& keyword, int page, int pageSize) const;
+
+        /**
+         * Get a page of the withdrawals in a time window, oldest first
+         * @param from the first time (YYYY-MM-DD or YYYY-MM-DD HH:MM:SS)
+         * @param to the last time, a date alone includes the whole day
+         * @param page the 1-based page number
+         * @param pageSize the records per page
+         */
+        WithdrawalPage findByTimeWindow(const string& from, string to, int page, int pageSize) const;
+
+        /**
+         * Display one page of a query result
+         * @param result the page to display
+         * @param page the 1-based page number
+         * @param pageSize the records per page
+         */
+        static void displayPage(const WithdrawalPage& result, int page, int pageSize);
+
+        // Get the current time
+        string getCurrentTime();
+};
+
+// Read players from a file
+map<string, string> readPlayersFromFile(const string& filename);
+
+// Structure for one substitution made by the substitution engine
+struct Substitution {
+    string matchId;
+    string withdrawnId;
+    string substituteId;    // Empty when no eligible player was free
+};
+
+/**
+ * Non-interactive substitute selection for withdrawn players.
+ * Free players are indexed per stage by ranking, so the closest-ranked free player
+ * is found with one ordered lookup. All matches affected by a batch of withdrawals
+ * are resolved together and Matches.txt is replaced in one rewrite by the background writer.
+ */
+class SubstitutionEngine {
+    private:
+        // One line of Matches.txt, kept as text so untouched lines are written back unchanged
+        struct MatchRow {
+            string line;
+            string matchId, stage, round, p1Id, p2Id, scheduledTime, matchStatus, courtId;
+            bool changed;
+        };
+
+        vector<MatchRow> rows;
+        unordered_map<string, vector<int>> waitingByPlayer;     // Player ID to rows of their waiting matches
+        unordered_map<string, pair<int, string>> playerInfo;   // Player ID to {ranking, stage}
+        unordered_map<string, set<pair<int, string>>> stagePools;  // Stage to free {ranking, player ID}
+
+        /**
+         * Remove a player from the free pool of their stage
+         * @param playerId the player ID
+         */
+        void markBooked(const string& playerId);
+
+        /**
+         * Take the free player of a stage whose ranking is closest to a ranking
+         * @param stage the stage of the match
+         * @param ranking the ranking to match (ties go to the better ranked player)
+         * @return the substitute's player ID, empty if the pool is empty
+         */
+        string takeClosest(const string& stage, int ranking);
+
+    public:
+        /**
+         * Load the players and matches and build the free player pools
+         * @param playersFile the players file
+         * @param matchesFile the matches file
+         * @param withdrawalsFile the withdrawals file (players already withdrawn are never picked)
+         * @return True if the players and matches could be read, else False
+         */
+        bool load(const string& playersFile, const string& matchesFile, const string& withdrawalsFile);
+
+        /**
+         * Replace withdrawn players in every waiting match
+         * @param withdrawnIds the IDs of the withdrawn players
+         * @return one entry per replaced player slot
+         */
+        vector<Substitution> substitute(const vector<string>& withdrawnIds);
+
+        /**
+         * Rewrite the matches file through the background writer and wait for the write
+         * @param matchesFile the matches file
+         * @return True if the file was replaced, else False
+         */
+        bool save(const string& matchesFile);
+};
+
+// Substitute withdrawn players in all their waiting matches
+vector<Substitution> substitutePlayers(const vector<string>& playerIds, const string& matchesFile, const string& playersFile);
+
+// Substitute a withdrawn player in all of their waiting matches
+void substitutePlayer(const string& playerId, const string& matchesFile, const string& playersFile);
+
+// Withdraw a batch of players and substitute them in all of their waiting matches
+void withdrawPlayers(PlayerWithdrawals &withdrawals, const vector<WithdrawalRequest>& requests);
+
+
+
+#endif
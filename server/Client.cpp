@@ -0,0 +1,85 @@
+#include "Client.h"
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <cerrno>
+
+bool ServerClient::connect(const string& path) {
+    disconnect();
+    sockaddr_un address;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if (path.size() >= sizeof(address.sun_path)) return false;
+    strcpy(address.sun_path, path.c_str());
+
+    fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0) return false;
+    if (::connect(fd, (sockaddr*)&address, sizeof(address)) != 0) {
+        disconnect();
+        return false;
+    }
+    return true;
+}
+
+void ServerClient::disconnect() {
+    if (fd >= 0) close(fd);
+    fd = -1;
+    in.clear();
+    inOffset = 0;
+}
+
+uint32_t ServerClient::send(uint8_t opcode, const vector<string>& fields) {
+    if (fd < 0) return 0;
+    Message request{opcode, nextRequestID++, fields};
+    if (request.requestID == 0) request.requestID = nextRequestID++;
+    string frame;
+    encodeMessage(frame, request);
+
+    size_t sent = 0;
+    while (sent < frame.size()) {
+        ssize_t length = ::send(fd, frame.data() + sent, frame.size() - sent, MSG_NOSIGNAL);
+        if (length < 0 && errno == EINTR) continue;
+        if (length <= 0) {
+            disconnect();
+            return 0;
+        }
+        sent += length;
+    }
+    return request.requestID;
+}
+
+bool ServerClient::receive(Message& response) {
+    char buffer[65536];
+    while (fd >= 0) {
+        uint32_t bodySize;
+        int frame = nextFrame(in, inOffset, bodySize);
+        if (frame == 1) {
+            bool decoded = decodeMessage(in.data() + inOffset + FRAME_HEADER_SIZE, bodySize, response);
+            inOffset += FRAME_HEADER_SIZE + bodySize;
+            if (inOffset == in.size()) {
+                in.clear();
+                inOffset = 0;
+            }
+            if (decoded) return true;
+            frame = -1;
+        }
+        if (frame < 0) break;
+
+        ssize_t length = recv(fd, buffer, sizeof(buffer), 0);
+        if (length < 0 && errno == EINTR) continue;
+        if (length <= 0) break;
+        in.append(buffer, length);
+    }
+    disconnect();
+    return false;
+}
+
+bool ServerClient::call(uint8_t opcode, const vector<string>& fields, Message& response) {
+    uint32_t requestID = send(opcode, fields);
+    if (requestID == 0) return false;
+    // Responses to requests sent earlier without waiting are skipped
+    while (receive(response)) {
+        if (response.requestID == requestID) return true;
+    }
+    return false;
+}
@@ -0,0 +1,56 @@
+#ifndef SERVER_CLIENT_H
+#define SERVER_CLIENT_H
+
+#include "Protocol.h"
+
+/**
+ * Blocking client of the tournament server.
+ * Requests can be pipelined: send() several, then receive() the responses, which are matched by request ID.
+ */
+class ServerClient {
+    private:
+        int fd;
+        string in;                  // Received bytes not yet parsed
+        size_t inOffset;
+        uint32_t nextRequestID;
+
+    public:
+        ServerClient() : fd(-1), inOffset(0), nextRequestID(1) {}
+        ~ServerClient() { disconnect(); }
+        ServerClient(const ServerClient&) = delete;
+        ServerClient& operator=(const ServerClient&) = delete;
+
+        /**
+         * Connect to a server
+         * @param path the socket path
+         * @return True if connected, else False
+         */
+        bool connect(const string& path);
+
+        void disconnect();
+
+        bool isConnected() const { return fd >= 0; }
+
+        /**
+         * Send one request without waiting for its response
+         * @param opcode the request
+         * @param fields the request fields
+         * @return the request ID, 0 if the connection failed
+         */
+        uint32_t send(uint8_t opcode, const vector<string>& fields);
+
+        /**
+         * Wait for the next response
+         * @param response Output: the response
+         * @return True if a response was received, else False (the connection closed)
+         */
+        bool receive(Message& response);
+
+        /**
+         * Send one request and wait for its response
+         * @return True if the response was received, else False
+         */
+        bool call(uint8_t opcode, const vector<string>& fields, Message& response);
+};
+
+#endif
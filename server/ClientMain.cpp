@@ -0,0 +1,41 @@
+#include "Client.h"
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------
+ * ------------------------------------------------ Tournament Client ---------------------------------------------
+ * ----------------------------------------------------------------------------------------------------------------
+ * Usage: tournament_client [--socket PATH] REQUEST [FIELD...]
+ * Sends one request (see server/Protocol.h) and prints the fields of the response, one per line.
+ * Exits with 0 for a successful response, 1 for a failed one and 2 if the server cannot be reached.
+ */
+
+int main(int argc, char* argv[]) {
+    string socketPath = "tournament.sock";
+    int first = 1;
+    if (argc > 2 && string(argv[1]) == "--socket") {
+        socketPath = argv[2];
+        first = 3;
+    }
+    uint8_t opcode = first < argc ? opcodeOf(argv[first]) : 0;
+    if (opcode == 0) {
+        cerr << "Usage: " << argv[0] << " [--socket PATH] REQUEST [FIELD...]" << endl;
+        cerr << "Requests: PING, LIST_MATCHES, ADVANCE_PLAYER, BUY_TICKET, GATE, COURT_CAPACITY, "
+             << "WITHDRAW, RECORD_RESULT, PLAYER_STATS" << endl;
+        return 2;
+    }
+    vector<string> fields(argv + first + 1, argv + argc);
+
+    ServerClient client;
+    if (!client.connect(socketPath)) {
+        cerr << "Error: cannot connect to " << socketPath << endl;
+        return 2;
+    }
+    Message response;
+    if (!client.call(opcode, fields, response)) {
+        cerr << "Error: the server closed the connection" << endl;
+        return 2;
+    }
+    ostream& out = response.code == STATUS_OK ? cout : cerr;
+    for (const string& field : response.fields) out << field << "\n";
+    return response.code == STATUS_OK ? 0 : 1;
+}
@@ -0,0 +1,115 @@
+#ifndef SERVER_PROTOCOL_H
+#define SERVER_PROTOCOL_H
+
+#include "core/ByteBuffer.h"
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------
+ * ----------------------------------------------- Server Protocol ------------------------------------------------
+ * ----------------------------------------------------------------------------------------------------------------
+ * Requests and responses are frames on a local stream socket:
+ *   uint32 body length, then the body: uint8 opcode (request) or status (response), uint32 request ID,
+ *   uint16 field count and the fields as length-prefixed strings (see ByteWriter).
+ * A client may send many requests without waiting; each response carries the ID of its request, and
+ * responses to requests on different subsystems can come back in a different order.
+ *
+ * Requests (fields) and the fields of a successful response:
+ *   PING                                          -> "pong"
+ *   LIST_MATCHES     [stageID]                    -> one "matchID,stage,round,p1,p2,time,status,court" per match
+ *   ADVANCE_PLAYER   playerID                     -> playerID
+ *   BUY_TICKET       name, ticketType, matchID, seats -> status (Purchased/Rejected), ticketID, seat labels
+ *   GATE             ticketID, entry|exit         -> status (Passed/Refused), court capacity after the pass
+ *   COURT_CAPACITY   courtID                      -> capacity
+ *   WITHDRAW         playerID, name, reason       -> withdrawalID, substitutions made
+ *   RECORD_RESULT    matchID, score1, score2, duration -> historyID, winner
+ *   PLAYER_STATS     playerID                     -> rating, rating rank, win rate rank
+ * A failed request has status ERROR and one field with the reason.
+ */
+
+const uint32_t MAX_FRAME_SIZE = 1 << 20;    // Larger frames close the connection
+const size_t FRAME_HEADER_SIZE = 4;
+
+enum Opcode : uint8_t {
+    OP_PING = 1,
+    OP_LIST_MATCHES,
+    OP_ADVANCE_PLAYER,
+    OP_BUY_TICKET,
+    OP_GATE,
+    OP_COURT_CAPACITY,
+    OP_WITHDRAW,
+    OP_RECORD_RESULT,
+    OP_PLAYER_STATS
+};
+
+enum ResponseStatus : uint8_t {
+    STATUS_OK = 0,
+    STATUS_ERROR = 1,
+    STATUS_UNKNOWN_OP = 2,
+    STATUS_BAD_REQUEST = 3
+};
+
+// A decoded request or response
+struct Message {
+    uint8_t code;           // Opcode of a request, status of a response
+    uint32_t requestID;
+    vector<string> fields;
+};
+
+/**
+ * Append one framed message to a buffer
+ * @param out the buffer
+ * @param message the message
+ */
+inline void encodeMessage(string& out, const Message& message) {
+    ByteWriter writer(out);
+    size_t start = out.size();
+    writer.number<uint32_t>(0);
+    writer.number<uint8_t>(message.code);
+    writer.number<uint32_t>(message.requestID);
+    writer.number<uint16_t>(min(message.fields.size(), (size_t)UINT16_MAX));
+    for (size_t i = 0; i < message.fields.size() && i < UINT16_MAX; i++) writer.text(message.fields[i]);
+    writer.patch<uint32_t>(start, out.size() - start - FRAME_HEADER_SIZE);
+}
+
+/**
+ * Decode a frame body
+ * @param body the bytes after the length
+ * @param size the body length
+ * @param message Output: the message
+ * @return True if the body is a complete message, else False
+ */
+inline bool decodeMessage(const char* body, size_t size, Message& message) {
+    ByteReader reader(body, size);
+    message.code = reader.number<uint8_t>();
+    message.requestID = reader.number<uint32_t>();
+    uint16_t count = reader.number<uint16_t>();
+    message.fields.clear();
+    for (int i = 0; i < count && reader.good(); i++) message.fields.push_back(reader.text());
+    return reader.good() && reader.atEnd();
+}
+
+/**
+ * Find the next complete frame in a receive buffer
+ * @param buffer the received bytes
+ * @param offset the position of the next frame
+ * @param bodySize Output: the body length of the frame
+ * @return 1 if a complete frame starts at the offset, 0 if more bytes are needed, -1 if the frame is too large
+ */
+inline int nextFrame(const string& buffer, size_t offset, uint32_t& bodySize) {
+    if (buffer.size() - offset < FRAME_HEADER_SIZE) return 0;
+    memcpy(&bodySize, buffer.data() + offset, FRAME_HEADER_SIZE);
+    if (bodySize > MAX_FRAME_SIZE) return -1;
+    return buffer.size() - offset - FRAME_HEADER_SIZE >= bodySize ? 1 : 0;
+}
+
+// Opcode of a request name e.g. BUY_TICKET, 0 if unknown
+inline uint8_t opcodeOf(const string& name) {
+    static const char* names[] = {"PING", "LIST_MATCHES", "ADVANCE_PLAYER", "BUY_TICKET", "GATE",
+                                  "COURT_CAPACITY", "WITHDRAW", "RECORD_RESULT", "PLAYER_STATS"};
+    for (int i = 0; i < (int)(sizeof(names) / sizeof(names[0])); i++) {
+        if (name == names[i]) return OP_PING + i;
+    }
+    return 0;
+}
+
+#endif
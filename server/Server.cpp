@@ -0,0 +1,429 @@
+#include "Server.h"
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+
+/** ---- Tournament service ---- */
+
+/**
+ * Get the size and modification time of a file as text
+ * @param filename the file
+ */
+static string fileSignature(const string& filename) {
+    syncFile(filename);
+    struct stat info;
+    if (stat(filename.c_str(), &info) != 0) return "-";
+    return to_string(info.st_size) + ":" + to_string(info.st_mtim.tv_sec) + "." + to_string(info.st_mtim.tv_nsec);
+}
+
+static string schedulingSignature() {
+    return fileSignature("Matches.txt") + "/" + fileSignature("Players.txt");
+}
+
+// Build an error response
+static Message errorResponse(const string& reason) {
+    return Message{STATUS_ERROR, 0, {reason}};
+}
+
+TournamentService::TournamentService() {
+    scheduler.reset(new TournamentScheduler());
+    schedulingFiles = schedulingSignature();
+    loadSeatMaps(ticketing);
+    // Sales, spectators and court capacities of earlier sessions come back from the event log
+    restoreTicketing(ticketing, EventLog::instance().state());
+}
+
+void TournamentService::refreshScheduler() {
+    string current = schedulingSignature();
+    if (current != schedulingFiles) {
+        scheduler.reset(new TournamentScheduler());
+        schedulingFiles = current;
+    }
+}
+
+void TournamentService::markSchedulerCurrent() {
+    schedulingFiles = schedulingSignature();
+}
+
+Message TournamentService::handle(const Message& request) {
+    INSTRUMENT_SCOPE("TournamentService::handle");
+    Message response;
+    try {
+        switch (request.code) {
+            case OP_PING: response = Message{STATUS_OK, 0, {"pong"}}; break;
+            case OP_LIST_MATCHES: response = listMatches(request); break;
+            case OP_ADVANCE_PLAYER: response = advancePlayer(request); break;
+            case OP_BUY_TICKET: response = buyTicket(request); break;
+            case OP_GATE: response = passGate(request); break;
+            case OP_COURT_CAPACITY: response = courtCapacity(request); break;
+            case OP_WITHDRAW: response = withdrawPlayer(request); break;
+            case OP_RECORD_RESULT: response = recordResult(request); break;
+            case OP_PLAYER_STATS: response = playerStats(request); break;
+            default: response = Message{STATUS_UNKNOWN_OP, 0, {"Unknown request"}};
+        }
+    } catch (const exception& e) {
+        response = errorResponse(e.what());
+    }
+    response.requestID = request.requestID;
+    return response;
+}
+
+Message TournamentService::listMatches(const Message& request) {
+    string stageID = request.fields.empty() ? "" : request.fields[0];
+    lock_guard<mutex> lock(schedulingMutex);
+    refreshScheduler();
+    Message response{STATUS_OK, 0, {}};
+    for (int i = 0; i < scheduler -> getMatchCount(); i++) {
+        const Matches& match = scheduler -> getMatch(i);
+        if (!stageID.empty() && match.stageID != stageID) continue;
+        response.fields.push_back(match.matchID + "," + match.stageID + "," + match.roundID + "," + match.p1ID + ","
+                                  + match.p2ID + "," + formatMatchTime(match.scheduledTime) + "," + match.matchStatus + ","
+                                  + match.courtID);
+    }
+    return response;
+}
+
+Message TournamentService::advancePlayer(const Message& request) {
+    if (request.fields.size() != 1) return Message{STATUS_BAD_REQUEST, 0, {"ADVANCE_PLAYER playerID"}};
+    lock_guard<mutex> lock(schedulingMutex);
+    refreshScheduler();
+    bool advanced = scheduler -> advancePlayerStage(request.fields[0]);
+    markSchedulerCurrent();
+    if (!advanced) return errorResponse("Player " + request.fields[0] + " cannot be advanced");
+    return Message{STATUS_OK, 0, {request.fields[0]}};
+}
+
+Message TournamentService::buyTicket(const Message& request) {
+    int seats = 0;
+    if (request.fields.size() != 4 || !parseInt(request.fields[3], seats) || seats <= 0) {
+        return Message{STATUS_BAD_REQUEST, 0, {"BUY_TICKET name ticketType matchID seats"}};
+    }
+    const string& ticketType = request.fields[1];
+    if (ticketType != "VIP" && ticketType != "Early-bird" && ticketType != "General") {
+        return errorResponse("Invalid ticket type " + ticketType);
+    }
+
+    lock_guard<mutex> lock(ticketingMutex);
+    ticketing.ticketableMatches.refresh(); // Reparse Matches.txt only if it changed
+    const Match* match = ticketing.ticketableMatches.find(request.fields[2]);
+    if (match == nullptr) return errorResponse("Match " + request.fields[2] + " is not on sale");
+    Spectator* spectator = sellTicket(ticketing, request.fields[0], ticketType, *match, seats);
+    if (spectator == nullptr) return Message{STATUS_OK, 0, {"Rejected", "", ""}};
+    return Message{STATUS_OK, 0, {"Purchased", spectator -> ticketID, spectator -> seatLabels}};
+}
+
+Message TournamentService::passGate(const Message& request) {
+    if (request.fields.size() != 2 || (request.fields[1] != "entry" && request.fields[1] != "exit")) {
+        return Message{STATUS_BAD_REQUEST, 0, {"GATE ticketID entry|exit"}};
+    }
+    lock_guard<mutex> lock(ticketingMutex);
+    Spectator* spectator = searchByTicketID(ticketing, request.fields[0]);
+    if (spectator == nullptr) return errorResponse("TicketID " + request.fields[0] + " is not found");
+    bool passed = passThroughGate(ticketing, request.fields[0], request.fields[1] == "entry");
+    return Message{STATUS_OK, 0, {passed ? "Passed" : "Refused", to_string(getCourtCapacity(ticketing, spectator -> courtID))}};
+}
+
+Message TournamentService::courtCapacity(const Message& request) {
+    if (request.fields.size() != 1) return Message{STATUS_BAD_REQUEST, 0, {"COURT_CAPACITY courtID"}};
+    lock_guard<mutex> lock(ticketingMutex);
+    for (int i = 0; i < NUM_COURTS; i++) {
+        if (ticketing.courts[i].courtID == request.fields[0]) {
+            return Message{STATUS_OK, 0, {to_string(ticketing.courts[i].capacity)}};
+        }
+    }
+    return errorResponse("Court " + request.fields[0] + " is not found");
+}
+
+Message TournamentService::withdrawPlayer(const Message& request) {
+    if (request.fields.size() != 3 || request.fields[0].empty()) {
+        return Message{STATUS_BAD_REQUEST, 0, {"WITHDRAW playerID name reason"}};
+    }
+    lock_guard<mutex> withdrawalsLock(withdrawalsMutex);
+    vector<Player> recorded = withdrawals.withdrawBatch({WithdrawalRequest{request.fields[0], request.fields[1], request.fields[2]}});
+    if (recorded.empty()) return errorResponse("The withdrawal was not recorded");
+
+    // Substitution rewrites Matches.txt, which the scheduler also writes
+    lock_guard<mutex> schedulingLock(schedulingMutex);
+    vector<Substitution> substitutions = substitutePlayers({request.fields[0]}, "Matches.txt", "Players.txt");
+    return Message{STATUS_OK, 0, {recorded[0].withdrawalId, to_string(substitutions.size())}};
+}
+
+Message TournamentService::recordResult(const Message& request) {
+    int score1 = 0, score2 = 0;
+    if (request.fields.size() != 4 || !parseInt(request.fields[1], score1) || !parseInt(request.fields[2], score2)) {
+        return Message{STATUS_BAD_REQUEST, 0, {"RECORD_RESULT matchID score1 score2 duration"}};
+    }
+    lock_guard<mutex> historyLock(historyMutex);
+    // A knockout result can schedule the next bracket match in Matches.txt
+    lock_guard<mutex> schedulingLock(schedulingMutex);
+    MatchHistory recorded;
+    if (!history.recordResult(request.fields[0], score1, score2, request.fields[3], recorded)) {
+        return errorResponse("Result of match " + request.fields[0] + " was not recorded");
+    }
+    string winner = score1 > score2 ? recorded.p1ID : recorded.p2ID;
+    return Message{STATUS_OK, 0, {recorded.historyID, winner}};
+}
+
+Message TournamentService::playerStats(const Message& request) {
+    if (request.fields.size() != 1) return Message{STATUS_BAD_REQUEST, 0, {"PLAYER_STATS playerID"}};
+    lock_guard<mutex> lock(historyMutex);
+    const string& playerID = request.fields[0];
+    ostringstream rating;
+    rating << fixed << setprecision(1) << history.getRatings().getRating(playerID);
+    return Message{STATUS_OK, 0, {rating.str(), to_string(history.getRatings().getRank(playerID)),
+                                  to_string(history.getWinRates().getRank(playerID))}};
+}
+
+/** ---- Request server ---- */
+
+// epoll tags of the two fixed descriptors; connections are tagged with their IDs from 2 up
+static const uint64_t LISTEN_TAG = 0;
+static const uint64_t WAKE_TAG = 1;
+
+RequestServer::RequestServer(TournamentService& tournament, const string& path, int workerThreads)
+    : service(tournament), socketPath(path), listenFd(-1), epollFd(-1), wakeFd(-1), nextConnectionID(2),
+      workerCount(max(1, workerThreads)), workersStopping(false), stopRequested(false) {}
+
+RequestServer::~RequestServer() {
+    {
+        lock_guard<mutex> lock(jobMutex);
+        workersStopping = true;
+    }
+    jobReady.notify_all();
+    for (thread& worker : workers) worker.join();
+    while (!connections.empty()) closeConnection(connections.begin() -> first);
+    if (listenFd >= 0) {
+        close(listenFd);
+        unlink(socketPath.c_str());
+    }
+    if (epollFd >= 0) close(epollFd);
+    if (wakeFd >= 0) close(wakeFd);
+}
+
+bool RequestServer::start() {
+    sockaddr_un address;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if (socketPath.size() >= sizeof(address.sun_path)) {
+        LOG_EVENT(LOG_ERROR, "server.badPath", "Error: socket path " << socketPath << " is too long.\n", {"path", socketPath});
+        return false;
+    }
+    strcpy(address.sun_path, socketPath.c_str());
+
+    listenFd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    // A socket file left by an earlier run that did not shut down is replaced
+    unlink(socketPath.c_str());
+    if (listenFd < 0 || bind(listenFd, (sockaddr*)&address, sizeof(address)) != 0 || listen(listenFd, SOMAXCONN) != 0) {
+        LOG_EVENT(LOG_ERROR, "server.listenFailed", "Error: cannot listen on " << socketPath << ": " << strerror(errno) << "\n",
+                  {"path", socketPath});
+        return false;
+    }
+
+    epollFd = epoll_create1(EPOLL_CLOEXEC);
+    wakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (epollFd < 0 || wakeFd < 0) return false;
+    epoll_event event;
+    event.events = EPOLLIN;
+    event.data.u64 = LISTEN_TAG;
+    epoll_ctl(epollFd, EPOLL_CTL_ADD, listenFd, &event);
+    event.data.u64 = WAKE_TAG;
+    epoll_ctl(epollFd, EPOLL_CTL_ADD, wakeFd, &event);
+
+    for (int i = 0; i < workerCount; i++) workers.emplace_back(&RequestServer::runWorker, this);
+    LOG_EVENT(LOG_INFO, "server.started", "Serving on " << socketPath << " with " << workerCount << " workers.\n",
+              {"path", socketPath}, {"workers", to_string(workerCount)});
+    return true;
+}
+
+void RequestServer::stop() {
+    stopRequested.store(true);
+    uint64_t one = 1;
+    ssize_t written = write(wakeFd, &one, sizeof(one));
+    (void)written;
+}
+
+void RequestServer::run() {
+    const int MAX_EVENTS = 64;
+    epoll_event events[MAX_EVENTS];
+    while (!stopRequested.load()) {
+        int ready = epoll_wait(epollFd, events, MAX_EVENTS, -1);
+        if (ready < 0) {
+            if (errno == EINTR) continue;
+            break;
+        }
+        for (int i = 0; i < ready; i++) {
+            uint64_t tag = events[i].data.u64;
+            if (tag == LISTEN_TAG) {
+                acceptConnections();
+            } else if (tag == WAKE_TAG) {
+                uint64_t count;
+                ssize_t drained = read(wakeFd, &count, sizeof(count));
+                (void)drained;
+                drainCompletions();
+            } else {
+                if (events[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR)) readConnection(tag);
+                if (events[i].events & EPOLLOUT) flushConnection(tag);
+            }
+        }
+    }
+    LOG_EVENT(LOG_INFO, "server.stopped", "Server stopped.\n");
+}
+
+void RequestServer::acceptConnections() {
+    while (true) {
+        int fd = accept4(listenFd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd < 0) return;
+        uint64_t connectionID = nextConnectionID++;
+        connections[connectionID] = Connection{fd, "", 0, "", 0, false};
+        epoll_event event;
+        event.events = EPOLLIN;
+        event.data.u64 = connectionID;
+        epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &event);
+    }
+}
+
+void RequestServer::readConnection(uint64_t connectionID) {
+    auto it = connections.find(connectionID);
+    if (it == connections.end()) return;
+    Connection& connection = it -> second;
+
+    char buffer[65536];
+    bool closed = false;
+    while (true) {
+        ssize_t length = recv(connection.fd, buffer, sizeof(buffer), 0);
+        if (length > 0) {
+            connection.in.append(buffer, length);
+            continue;
+        }
+        if (length == 0 || (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)) closed = true;
+        if (length < 0 && errno == EINTR) continue;
+        break;
+    }
+
+    // Every complete frame becomes a job; the batch is queued under one lock
+    vector<Job> batch;
+    uint32_t bodySize;
+    int frame;
+    while ((frame = nextFrame(connection.in, connection.inOffset, bodySize)) == 1) {
+        Job job{connectionID, Message()};
+        if (!decodeMessage(connection.in.data() + connection.inOffset + FRAME_HEADER_SIZE, bodySize, job.request)) {
+            frame = -1;
+            break;
+        }
+        batch.push_back(move(job));
+        connection.inOffset += FRAME_HEADER_SIZE + bodySize;
+    }
+    if (connection.inOffset == connection.in.size()) {
+        connection.in.clear();
+        connection.inOffset = 0;
+    } else if (connection.inOffset > 65536) {
+        connection.in.erase(0, connection.inOffset);
+        connection.inOffset = 0;
+    }
+
+    if (!batch.empty()) {
+        {
+            lock_guard<mutex> lock(jobMutex);
+            for (Job& job : batch) jobs.push_back(move(job));
+        }
+        if (batch.size() == 1) {
+            jobReady.notify_one();
+        } else {
+            jobReady.notify_all();
+        }
+    }
+    // A malformed frame cannot be resynchronised, so the connection is dropped
+    if (closed || frame < 0) closeConnection(connectionID);
+}
+
+void RequestServer::flushConnection(uint64_t connectionID) {
+    auto it = connections.find(connectionID);
+    if (it == connections.end()) return;
+    Connection& connection = it -> second;
+    while (connection.outOffset < connection.out.size()) {
+        ssize_t sent = send(connection.fd, connection.out.data() + connection.outOffset,
+                            connection.out.size() - connection.outOffset, MSG_NOSIGNAL);
+        if (sent > 0) {
+            connection.outOffset += sent;
+            continue;
+        }
+        if (sent < 0 && errno == EINTR) continue;
+        if (sent < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) break;
+        closeConnection(connectionID);
+        return;
+    }
+
+    bool pending = connection.outOffset < connection.out.size();
+    if (!pending) {
+        connection.out.clear();
+        connection.outOffset = 0;
+    }
+    // Writable events are only wanted while responses are waiting
+    if (pending != connection.wantWrite) {
+        connection.wantWrite = pending;
+        epoll_event event;
+        event.events = EPOLLIN;
+        if (pending) event.events |= EPOLLOUT;
+        event.data.u64 = connectionID;
+        epoll_ctl(epollFd, EPOLL_CTL_MOD, connection.fd, &event);
+    }
+}
+
+void RequestServer::closeConnection(uint64_t connectionID) {
+    auto it = connections.find(connectionID);
+    if (it == connections.end()) return;
+    epoll_ctl(epollFd, EPOLL_CTL_DEL, it -> second.fd, nullptr);
+    close(it -> second.fd);
+    connections.erase(it);
+}
+
+void RequestServer::drainCompletions() {
+    vector<Completion> ready;
+    {
+        lock_guard<mutex> lock(completionMutex);
+        ready.swap(completions);
+    }
+    // Responses of one connection are sent together
+    unordered_set<uint64_t> touched;
+    for (Completion& completion : ready) {
+        auto it = connections.find(completion.connectionID);
+        if (it == connections.end()) continue;  // The client has gone
+        it -> second.out += completion.frame;
+        touched.insert(completion.connectionID);
+    }
+    for (uint64_t connectionID : touched) flushConnection(connectionID);
+}
+
+void RequestServer::runWorker() {
+    while (true) {
+        Job job;
+        {
+            unique_lock<mutex> lock(jobMutex);
+            jobReady.wait(lock, [this]() { return workersStopping || !jobs.empty(); });
+            if (jobs.empty()) return;
+            job = move(jobs.front());
+            jobs.pop_front();
+        }
+
+        Message response = service.handle(job.request);
+        Completion completion{job.connectionID, ""};
+        encodeMessage(completion.frame, response);
+
+        bool first;
+        {
+            lock_guard<mutex> lock(completionMutex);
+            first = completions.empty();
+            completions.push_back(move(completion));
+        }
+        // The I/O thread is woken once per batch of completions
+        if (first) {
+            uint64_t one = 1;
+            ssize_t written = write(wakeFd, &one, sizeof(one));
+            (void)written;
+        }
+    }
+}
@@ -0,0 +1,152 @@
+#ifndef SERVER_SERVER_H
+#define SERVER_SERVER_H
+
+#include "Protocol.h"
+#include "core/Scheduling.h"
+#include "core/Ticketing.h"
+#include "core/Withdrawals.h"
+#include "core/MatchHistory.h"
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <atomic>
+#include <memory>
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------
+ * ----------------------------------------------------- Server ---------------------------------------------------
+ * ----------------------------------------------------------------------------------------------------------------
+ * Server mode: the scheduling, ticketing, gate, withdrawal and history operations served over a local
+ * Unix-domain socket (see Protocol.h). One I/O thread runs an epoll loop over the connections and hands
+ * complete requests to a worker pool; the workers take the lock of the subsystem a request needs, so
+ * box offices and gate terminals only wait for each other on the same subsystem.
+ */
+
+/**
+ * The tournament state shared by the clients, with one lock per subsystem.
+ * Requests that need several subsystems lock them in the order withdrawals, history, scheduling, ticketing.
+ */
+class TournamentService {
+    private:
+        // Scheduling: rebuilt when Matches.txt or Players.txt changed under it
+        mutex schedulingMutex;
+        unique_ptr<TournamentScheduler> scheduler;
+        string schedulingFiles;     // Size and modification time of the files the scheduler was loaded from
+
+        // Ticketing: one session for every box office and gate
+        mutex ticketingMutex;
+        TicketingContext ticketing;
+
+        mutex withdrawalsMutex;
+        PlayerWithdrawals withdrawals;
+
+        mutex historyMutex;
+        MatchHistoryManager history;
+
+        // Reload the scheduler if its files changed (scheduling lock held)
+        void refreshScheduler();
+
+        // Remember the scheduler's files after it wrote them (scheduling lock held)
+        void markSchedulerCurrent();
+
+        // Request handlers; the response status and fields
+        Message listMatches(const Message& request);
+        Message advancePlayer(const Message& request);
+        Message buyTicket(const Message& request);
+        Message passGate(const Message& request);
+        Message courtCapacity(const Message& request);
+        Message withdrawPlayer(const Message& request);
+        Message recordResult(const Message& request);
+        Message playerStats(const Message& request);
+
+    public:
+        TournamentService();
+        TournamentService(const TournamentService&) = delete;
+        TournamentService& operator=(const TournamentService&) = delete;
+
+        /**
+         * Handle one request; safe to call from any thread
+         * @param request the request
+         * @return the response, with the request's ID
+         */
+        Message handle(const Message& request);
+};
+
+/**
+ * Event-loop socket server with a worker pool
+ */
+class RequestServer {
+    private:
+        // A client connection, owned by the I/O thread
+        struct Connection {
+            int fd;
+            string in;              // Received bytes not yet parsed
+            size_t inOffset;        // Start of the first unparsed frame
+            string out;             // Encoded responses not yet sent
+            size_t outOffset;
+            bool wantWrite;         // Registered for EPOLLOUT
+        };
+
+        // A request waiting for a worker
+        struct Job {
+            uint64_t connectionID;
+            Message request;
+        };
+
+        // An encoded response waiting for the I/O thread
+        struct Completion {
+            uint64_t connectionID;
+            string frame;
+        };
+
+        TournamentService& service;
+        string socketPath;
+        int listenFd;
+        int epollFd;
+        int wakeFd;                 // eventfd that wakes the I/O thread for completions and stop()
+        unordered_map<uint64_t, Connection> connections;
+        uint64_t nextConnectionID;
+
+        int workerCount;
+        vector<thread> workers;
+        mutex jobMutex;
+        condition_variable jobReady;
+        deque<Job> jobs;
+        bool workersStopping;
+
+        mutex completionMutex;
+        vector<Completion> completions;
+        atomic<bool> stopRequested;
+
+        void acceptConnections();
+        void readConnection(uint64_t connectionID);
+        void flushConnection(uint64_t connectionID);
+        void closeConnection(uint64_t connectionID);
+        void drainCompletions();
+        void runWorker();
+
+    public:
+        /**
+         * @param tournament the service the requests are handled by
+         * @param path the socket path
+         * @param workerThreads the worker pool size
+         */
+        RequestServer(TournamentService& tournament, const string& path, int workerThreads);
+        ~RequestServer();
+        RequestServer(const RequestServer&) = delete;
+        RequestServer& operator=(const RequestServer&) = delete;
+
+        /**
+         * Bind and listen on the socket and start the workers
+         * @return True if the server is ready, else False
+         */
+        bool start();
+
+        // Serve until stop() is called
+        void run();
+
+        // Ask the event loop to stop; safe to call from a signal handler
+        void stop();
+};
+
+#endif
@@ -0,0 +1,88 @@
+#include "Server.h"
+#include "core/Logger.h"
+#include <csignal>
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------
+ * ------------------------------------------------ Tournament Server ---------------------------------------------
+ * ----------------------------------------------------------------------------------------------------------------
+ * Usage: tournament_server [--socket PATH] [--workers N] [--events FILE] [--verbose]
+ * Serves the tournament files in the current directory until SIGINT or SIGTERM.
+ * The console messages of the core are dropped unless --verbose is given; --events writes every
+ * structured event to a JSON lines file instead.
+ */
+
+// Stream buffer that drops everything, so the console messages of the core cost no terminal writes
+class NullBuffer : public streambuf {
+    protected:
+        int overflow(int c) override { return c; }
+};
+
+static RequestServer* runningServer = nullptr;
+
+static void handleStopSignal(int) {
+    if (runningServer != nullptr) runningServer -> stop();
+}
+
+int main(int argc, char* argv[]) {
+    string socketPath = "tournament.sock";
+    int workerThreads = max(2u, thread::hardware_concurrency());
+    string eventFile;
+    bool verbose = false;
+
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--socket" && hasValue) {
+            socketPath = argv[++i];
+        } else if (arg == "--workers" && hasValue) {
+            workerThreads = max(1, atoi(argv[++i]));
+        } else if (arg == "--events" && hasValue) {
+            eventFile = argv[++i];
+        } else if (arg == "--verbose") {
+            verbose = true;
+        } else {
+            cerr << "Usage: " << argv[0] << " [--socket PATH] [--workers N] [--events FILE] [--verbose]" << endl;
+            return 2;
+        }
+    }
+
+    // cout must get its own buffer back before main returns: static destructors still write to it
+    NullBuffer nullBuffer;
+    streambuf* coutBuffer = cout.rdbuf();
+    if (!verbose) {
+        cout.rdbuf(&nullBuffer);
+        Logger::instance().setQuiet(true);
+    }
+    if (!eventFile.empty() && !Logger::instance().setEventFile(eventFile)) {
+        cerr << "Error: cannot open " << eventFile << endl;
+        cout.rdbuf(coutBuffer);
+        return 1;
+    }
+    Logger::instance().startAsync();
+
+    // Responses to a client that has gone fail with EPIPE instead of killing the server
+    signal(SIGPIPE, SIG_IGN);
+
+    int status = 0;
+    {
+        TournamentService service;
+        RequestServer server(service, socketPath, workerThreads);
+        if (server.start()) {
+            runningServer = &server;
+            signal(SIGINT, handleStopSignal);
+            signal(SIGTERM, handleStopSignal);
+            cerr << "Serving on " << socketPath << " with " << workerThreads << " workers" << endl;
+            server.run();
+            signal(SIGINT, SIG_DFL);
+            signal(SIGTERM, SIG_DFL);
+            runningServer = nullptr;
+        } else {
+            cerr << "Error: cannot serve on " << socketPath << endl;
+            status = 1;
+        }
+    }
+    Logger::instance().stopAsync();
+    cout.rdbuf(coutBuffer);
+    return status;
+}
@@ -0,0 +1,52 @@
+#include "TestSupport.h"
+#include "core/Scheduling.h"
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------
+ * -------------------------------------------------- Date Tests --------------------------------------------------
+ * ----------------------------------------------------------------------------------------------------------------
+ */
+
+TEST_CASE(matchTimeRoundTrip) {
+    MatchTime time = makeMatchTime(29, 2, 2028, 18, 45);
+    CHECK_EQUAL(formatMatchTime(time), string("29-02-2028 18:45"));
+    CHECK_EQUAL(parseMatchTime("29-02-2028 18:45"), time);
+    CHECK_EQUAL(parseMatchTime("TBD"), TIME_TBD);
+    CHECK_EQUAL(parseMatchTime("29-02-2027 18:45"), TIME_INVALID);
+
+    // The last representable year still orders after the years before it
+    MatchTime last = makeMatchTime(31, 12, MATCH_TIME_LAST_YEAR, 23, 59);
+    CHECK(last > makeMatchTime(1, 1, MATCH_TIME_LAST_YEAR));
+    CHECK_EQUAL(parseMatchTime(formatMatchTime(last)), last);
+}
+
+TEST_CASE(matchTimeRejectsYearsOutOfRange) {
+    // Minutes of the year 6054 no longer fit in 32 bits; they must fail instead of wrapping
+    CHECK_EQUAL(makeMatchTime(1, 1, 6054), TIME_INVALID);
+    CHECK_EQUAL(makeMatchTime(1, 1, MATCH_TIME_LAST_YEAR + 1), TIME_INVALID);
+    CHECK_EQUAL(makeMatchTime(31, 12, MATCH_TIME_FIRST_YEAR - 1), TIME_INVALID);
+    CHECK_EQUAL(parseMatchTime("01-01-6054 07:00"), TIME_INVALID);
+    CHECK_EQUAL(parseMatchTime("01-01-9999"), TIME_INVALID);
+    CHECK_EQUAL(parseMatchTime("31-12-1969"), TIME_INVALID);
+}
+
+TEST_CASE(tournamentStartIsConfigurable) {
+    // ctest runs this case with TOURNAMENT_START set; without it the default date is used
+    const char* configured = getenv("TOURNAMENT_START");
+    MatchTime expected = parseMatchTime(configured && *configured ? configured : DEFAULT_TOURNAMENT_START);
+    CHECK_EQUAL(tournamentStart(), expected);
+    CHECK_EQUAL(tournamentStart() % 1440, 0);
+
+    // Every court's day grid starts on it
+    ofstream("Court.txt") << "C001,Center,1500,2\nC002,Championship,1000,1\nC003,Progression,750,1\n";
+    ofstream("Players.txt") << "P001,Player 1,MY,1,M,S001\nP002,Player 2,MY,2,F,S001\n";
+    ofstream("Matches.txt").close();
+    TournamentScheduler scheduler;
+    CHECK_EQUAL(scheduler.scheduleAllStages(), 1);
+    AsyncFileWriter::instance().flush();
+    ifstream file("Matches.txt");
+    string line;
+    CHECK(getline(file, line));
+    string day = formatMatchTime(expected).substr(0, 10);
+    CHECK(line.find("," + day + " ") != string::npos);
+}
@@ -0,0 +1,213 @@
+#include "TestSupport.h"
+#include "core/EventLog.h"
+#include "core/Scheduling.h"
+
+#include <thread>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------
+ * ------------------------------------------------ Event Log Tests -----------------------------------------------
+ * ----------------------------------------------------------------------------------------------------------------
+ */
+
+// Binary form of a state, so two states compare field by field in one check
+static string serialized(const TournamentState& state) {
+    string bytes;
+    state.serialize(bytes);
+    return bytes;
+}
+
+// Replay a whole log file into a fresh state
+static TournamentState replayAll(const string& filename, long long& applied) {
+    TournamentState state;
+    uint64_t validEnd;
+    applied = EventLog::replay(filename, 0, INT64_MAX, state, validEnd);
+    return state;
+}
+
+// Size of a file in bytes
+static long long fileSize(const string& filename) {
+    struct stat info;
+    return stat(filename.c_str(), &info) == 0 ? info.st_size : -1;
+}
+
+/**
+ * Append one event of every type, in separate batches and in one batch
+ * @param log the event log
+ */
+static void appendMixedEvents(EventLog& log) {
+    MatchTime start = makeMatchTime(28, 4, 2025, 9);
+    log.append(MatchScheduledEvent{"M001", "S001", "R001", "P001", "P002", start, "Scheduled", "C003"});
+    log.append(vector<EventPayload>{
+        MatchScheduledEvent{"M002", "S001", "R001", "P003", "P004", start + 60, "Scheduled", "C003"},
+        PlayerAdvancedEvent{"P001", "", "S001"},
+        PlayerAdvancedEvent{"P003", "", "S001"},
+    });
+    log.append(PlayerWithdrawnEvent{"W001", "P004", "Player 4", "Injury"});
+    log.append(PlayerSubstitutedEvent{"M002", "P004", "P005"});
+    log.append(MatchScheduledEvent{"M002", "S001", "R001", "P003", "P005", start + 60, "Scheduled", "C003"});
+    log.append(TicketSoldEvent{"TKS001", "Ann", "VIP", "C003", "M001", 4, "Purchased", "A-R01-S01..S04"});
+    log.append(TicketSoldEvent{"TKS002", "Ben", "General", "C003", "M001", 900, "Rejected", ""});
+    log.append(GatePassedEvent{"TKS001", "C003", true, 4, {2, 2, 0, 0, 0, 0}});
+    log.append(ResultRecordedEvent{"M001", "S001", "P001", "P002", 2, 1, start + 90, "01:30"});
+    log.append(MatchScheduledEvent{"M001", "S001", "R001", "P001", "P002", start, "Completed", "C003"});
+    log.append(PlayerAdvancedEvent{"P001", "S001", "S002"});
+    log.append(GatePassedEvent{"TKS001", "C003", false, 4, {}});
+}
+
+TEST_CASE(replayEqualsLiveState) {
+    EventLog log("Events.log", 0);
+    appendMixedEvents(log);
+    TournamentState live = log.state();
+    CHECK_EQUAL(live.eventCount, 14u);
+    CHECK_EQUAL(live.matches.size(), 2u);
+    CHECK_EQUAL(live.findMatch("M002") -> p2ID, string("P005"));
+    CHECK_EQUAL(live.playerStages["P001"], string("S002"));
+
+    long long applied;
+    TournamentState replayed = replayAll("Events.log", applied);
+    CHECK_EQUAL(applied, 14);
+    CHECK(serialized(replayed) == serialized(live));
+
+    // A log opened again rebuilds the same state
+    EventLog reopened("Events.log", 0);
+    CHECK(serialized(reopened.state()) == serialized(live));
+}
+
+TEST_CASE(schedulerReplayEqualsMatchesFile) {
+    ofstream players("Players.txt");
+    for (int i = 1; i <= 24; i++) {
+        players << "P" << setw(3) << setfill('0') << i << ",Player " << i << ",MY," << i << "," << (i % 2 ? "M" : "F") << ",S001\n";
+    }
+    players.close();
+    ofstream("Court.txt") << "C001,Center,1500,2\nC002,Championship,1000,1\nC003,Progression,750,1\n";
+    ofstream("Matches.txt").close();
+
+    TournamentScheduler scheduler;
+    CHECK(scheduler.scheduleAllStages() > 0);
+    AsyncFileWriter::instance().flush();
+
+    // Every row the scheduler saved is in the log exactly as saved, and nothing else is
+    long long applied;
+    TournamentState replayed = replayAll(EventLog::instance().getFilename(), applied);
+    CHECK(applied > 0);
+    ifstream file("Matches.txt");
+    string line;
+    size_t rows = 0;
+    while (getline(file, line)) {
+        stringstream ss(line);
+        string matchID, stageID, roundID, p1ID, p2ID, time, status, courtID;
+        getline(ss, matchID, ',');
+        getline(ss, stageID, ',');
+        getline(ss, roundID, ',');
+        getline(ss, p1ID, ',');
+        getline(ss, p2ID, ',');
+        getline(ss, time, ',');
+        getline(ss, status, ',');
+        getline(ss, courtID, ',');
+        const MatchScheduledEvent* match = replayed.findMatch(matchID);
+        CHECK(match != nullptr);
+        CHECK_EQUAL(match -> stageID, stageID);
+        CHECK_EQUAL(match -> roundID, roundID);
+        CHECK_EQUAL(match -> p1ID, p1ID);
+        CHECK_EQUAL(match -> p2ID, p2ID);
+        CHECK_EQUAL(formatMatchTime(match -> scheduledTime), time);
+        CHECK_EQUAL(match -> status, status);
+        CHECK_EQUAL(match -> courtID, courtID);
+        rows++;
+    }
+    CHECK(rows > 0);
+    CHECK_EQUAL(replayed.matches.size(), rows);
+    CHECK(serialized(replayed) == serialized(EventLog::instance().state()));
+}
+
+TEST_CASE(snapshotPlusTailEqualsFullReplay) {
+    {
+        EventLog log("Events.log", 4);
+        appendMixedEvents(log);
+    }
+    // 14 events with a snapshot every 4: the snapshot holds 12 of them and 2 are replayed after it
+    CHECK(fileSize("Events.log.snapshot") > 0);
+
+    long long applied;
+    TournamentState full = replayAll("Events.log", applied);
+    CHECK_EQUAL(applied, 14);
+
+    EventLog reopened("Events.log", 4);
+    TournamentState fromSnapshot = reopened.state();
+    CHECK_EQUAL(fromSnapshot.eventCount, 14u);
+    CHECK(serialized(fromSnapshot) == serialized(full));
+}
+
+TEST_CASE(tornTailIsTruncated) {
+    {
+        EventLog log("Events.log", 0);
+        appendMixedEvents(log);
+    }
+    long long intactSize = fileSize("Events.log");
+
+    // A crash in the middle of the last write leaves part of a record behind
+    {
+        EventLog log("Events.log", 0);
+        log.append(PlayerAdvancedEvent{"P003", "S001", "S002"});
+    }
+    long long fullSize = fileSize("Events.log");
+    CHECK(truncate("Events.log", fullSize - 5) == 0);
+
+    EventLog reopened("Events.log", 0);
+    TournamentState state = reopened.state();
+    CHECK_EQUAL(state.eventCount, 14u);
+    CHECK_EQUAL(state.playerStages["P003"], string("S001"));
+    CHECK_EQUAL(fileSize("Events.log"), intactSize);
+
+    // Appends continue right after the last whole record
+    reopened.append(PlayerAdvancedEvent{"P003", "S001", "S002"});
+    long long applied;
+    TournamentState replayed = replayAll("Events.log", applied);
+    CHECK_EQUAL(applied, 15);
+    CHECK_EQUAL(replayed.lastSequence, 15u);
+    CHECK_EQUAL(replayed.playerStages["P003"], string("S002"));
+}
+
+TEST_CASE(garbageTailIsTruncated) {
+    {
+        EventLog log("Events.log", 0);
+        appendMixedEvents(log);
+    }
+    long long intactSize = fileSize("Events.log");
+    ofstream("Events.log", ios::binary | ios::app) << "\x07garbage";
+
+    EventLog reopened("Events.log", 0);
+    CHECK_EQUAL(reopened.state().eventCount, 14u);
+    CHECK_EQUAL(fileSize("Events.log"), intactSize);
+}
+
+TEST_CASE(stateAsOfStopsAtTime) {
+    // A snapshot after every event, so the audit must fall back to a replay from the start
+    EventLog log("Events.log", 1);
+    MatchTime start = makeMatchTime(28, 4, 2025, 9);
+    log.append(MatchScheduledEvent{"M001", "S001", "R001", "P001", "P002", start, "Scheduled", "C003"});
+    int64_t firstTime = log.state().lastTimestamp;
+
+    // The next record needs a later timestamp (whole seconds)
+    while (time(0) <= firstTime) this_thread::sleep_for(chrono::milliseconds(50));
+    log.append(MatchScheduledEvent{"M001", "S001", "R001", "P001", "P002", start, "Completed", "C003"});
+    log.append(MatchScheduledEvent{"M002", "S001", "R001", "P003", "P004", start + 60, "Scheduled", "C003"});
+    int64_t lastTime = log.state().lastTimestamp;
+    CHECK(lastTime > firstTime);
+
+    TournamentState before = log.stateAsOf(firstTime - 1);
+    CHECK_EQUAL(before.eventCount, 0u);
+
+    TournamentState first = log.stateAsOf(firstTime);
+    CHECK_EQUAL(first.eventCount, 1u);
+    CHECK_EQUAL(first.matches.size(), 1u);
+    CHECK_EQUAL(first.findMatch("M001") -> status, string("Scheduled"));
+
+    TournamentState latest = log.stateAsOf(lastTime);
+    CHECK_EQUAL(latest.eventCount, 3u);
+    CHECK_EQUAL(latest.findMatch("M001") -> status, string("Completed"));
+    CHECK(serialized(latest) == serialized(log.state()));
+}
@@ -0,0 +1,88 @@
+#include "TestSupport.h"
+#include "core/MatchHistory.h"
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------
+ * ---------------------------------------------- Match History Tests ---------------------------------------------
+ * ----------------------------------------------------------------------------------------------------------------
+ */
+
+// Matches.txt with one qualifier and one round-robin match
+static void writeScheduledMatches() {
+    ofstream("Matches.txt") << "M001,S001,R001,P010,P011,28-04-2025 07:00,waiting,C003\n"
+                            << "M002,S002,R001,P020,P021,28-04-2025 09:00,waiting,C002\n";
+}
+
+TEST_CASE(recordResultRatesTheScheduledPlayers) {
+    writeScheduledMatches();
+    MatchHistoryManager history;
+    MatchHistory recorded;
+    CHECK(history.recordResult("M002", 1, 2, "95:00", recorded));
+
+    CHECK_EQUAL(recorded.stageID, string("S002"));
+    CHECK_EQUAL(recorded.p1ID, string("P020"));
+    CHECK_EQUAL(recorded.p2ID, string("P021"));
+    CHECK(history.getRatings().getRating("P021") > DEFAULT_RATING);
+    CHECK(history.getRatings().getRating("P020") < DEFAULT_RATING);
+
+    // The placeholder players of the old default row are never rated
+    CHECK_EQUAL(history.getRatings().getRank("APUTCP001"), 0);
+    CHECK_EQUAL(history.getRatings().getRank("APUTCP002"), 0);
+}
+
+TEST_CASE(recordResultRefusesUnknownMatch) {
+    writeScheduledMatches();
+    MatchHistoryManager history;
+    MatchHistory recorded;
+    CHECK(!history.recordResult("M999", 2, 0, "60:00", recorded));
+    CHECK(!history.getRatings().hasRatings());
+
+    // Level scores have no winner, so they are refused as well
+    CHECK(!history.recordResult("M001", 1, 1, "60:00", recorded));
+    CHECK(!history.getRatings().hasRatings());
+
+    // Nothing was written to the history
+    AsyncFileWriter::instance().flush();
+    ifstream file("MatchHistory.txt");
+    string line;
+    CHECK(!getline(file, line) || line.empty());
+}
+
+TEST_CASE(recordResultCountsWinRatesOfTheScheduledPlayers) {
+    writeScheduledMatches();
+    MatchHistoryManager history;
+    MatchHistory recorded;
+    CHECK(history.recordResult("M001", 2, 0, "70:00", recorded));
+    CHECK(history.recordResult("M002", 2, 1, "80:00", recorded));
+
+    const WinRateBoard& winRates = history.getWinRates();
+    CHECK_EQUAL(winRates.size(), 4);
+    CHECK_EQUAL(winRates.getRank("APUTCP001"), 0);
+    CHECK_EQUAL(winRates.getRank("APUTCP002"), 0);
+    CHECK(winRates.getRank("P010") >= 1 && winRates.getRank("P010") <= 2);
+    CHECK(winRates.getRank("P020") >= 1 && winRates.getRank("P020") <= 2);
+    CHECK(winRates.getRank("P011") >= 3);
+    CHECK(winRates.getRank("P021") >= 3);
+}
+
+TEST_CASE(recordResultLogsTheScheduledPlayers) {
+    writeScheduledMatches();
+    MatchHistoryManager history;
+    MatchHistory recorded;
+    CHECK(history.recordResult("M002", 0, 2, "80:00", recorded));
+    CHECK(!history.recordResult("M404", 2, 0, "80:00", recorded));
+
+    // The logged result carries the real players, so a replay rebuilds the same leaderboards
+    TournamentState state = EventLog::instance().state();
+    CHECK_EQUAL(state.results.size(), 1u);
+    const ResultRecordedEvent& result = state.results[0];
+    CHECK_EQUAL(result.matchID, string("M002"));
+    CHECK_EQUAL(result.stageID, string("S002"));
+    CHECK_EQUAL(result.p1ID, string("P020"));
+    CHECK_EQUAL(result.p2ID, string("P021"));
+
+    MatchHistoryManager replayed;
+    replayed.restoreFromState(state);
+    CHECK_EQUAL(replayed.getWinRates().getRank("P021"), 1);
+    CHECK_EQUAL(replayed.getRatings().getRating("P021"), history.getRatings().getRating("P021"));
+}
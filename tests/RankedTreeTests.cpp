@@ -0,0 +1,93 @@
+#include "TestSupport.h"
+#include "core/Scheduling.h"
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------
+ * ----------------------------------------------- Ranked Tree Tests ----------------------------------------------
+ * ----------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * Check every rank and k-th lookup of a tree against a sorted copy of its keys
+ * @param tree the tree
+ * @param keys the keys in the tree, in any order
+ */
+template <typename Key, typename Compare>
+static void checkAgainstSorted(const RankedTree<Key, Compare>& tree, vector<Key> keys) {
+    sort(keys.begin(), keys.end(), Compare());
+    CHECK_EQUAL(tree.size(), (int)keys.size());
+    for (int rank = 0; rank < (int)keys.size(); rank++) {
+        CHECK(tree.kth(rank) == keys[rank]);
+        CHECK_EQUAL(tree.rankOf(keys[rank]), rank);
+    }
+}
+
+TEST_CASE(rankedTreeRankAndKth) {
+    RankedTree<int> tree;
+    vector<int> keys;
+    mt19937 rng(7);
+    for (int i = 0; i < 500; i++) {
+        int key = rng() % 100000;
+        if (find(keys.begin(), keys.end(), key) != keys.end()) continue;
+        tree.insert(key);
+        keys.push_back(key);
+    }
+    checkAgainstSorted(tree, keys);
+
+    // A key that is not in the tree ranks after every smaller key
+    sort(keys.begin(), keys.end());
+    int absent = keys[10] + 1;
+    if (!binary_search(keys.begin(), keys.end(), absent)) {
+        CHECK_EQUAL(tree.rankOf(absent), 11);
+    }
+
+    // Erase every third key, then reuse the freed nodes
+    vector<int> kept;
+    for (size_t i = 0; i < keys.size(); i++) {
+        if (i % 3 == 0) CHECK(tree.erase(keys[i]));
+        else kept.push_back(keys[i]);
+    }
+    CHECK(!tree.erase(-1));
+    checkAgainstSorted(tree, kept);
+    for (int key = -50; key < 0; key++) {
+        tree.insert(key);
+        kept.push_back(key);
+    }
+    checkAgainstSorted(tree, kept);
+    CHECK_EQUAL(tree.kth(0), -50);
+}
+
+TEST_CASE(rankedTreeLeaderboardOrder) {
+    // The rating leaderboard: highest rating first, ties by player ID
+    RankedTree<RatingKey, HigherRatingFirst> tree;
+    vector<RatingKey> keys = {{1500.0, "P003"}, {1612.5, "P001"}, {1500.0, "P002"}, {1388.0, "P004"}, {1700.0, "P005"}};
+    for (const RatingKey& key : keys) tree.insert(key);
+    checkAgainstSorted(tree, keys);
+    CHECK_EQUAL(tree.kth(0).second, string("P005"));
+    CHECK_EQUAL(tree.rankOf(RatingKey(1500.0, "P002")), 2);
+    CHECK_EQUAL(tree.rankOf(RatingKey(1500.0, "P003")), 3);
+
+    // A rating change is an erase and an insert
+    CHECK(tree.erase(RatingKey(1388.0, "P004")));
+    tree.insert(RatingKey(1800.0, "P004"));
+    CHECK_EQUAL(tree.kth(0).second, string("P004"));
+    CHECK_EQUAL(tree.rankOf(RatingKey(1700.0, "P005")), 1);
+}
+
+TEST_CASE(ratingEngineRanks) {
+    RatingEngine engine;
+    engine.applyResult("P001", "P002", 2, 0);
+    engine.applyResult("P003", "P001", 2, 1);
+    engine.applyResult("P002", "P004", 2, 1);
+    CHECK(engine.getRating("P003") > DEFAULT_RATING);
+    CHECK(engine.getRating("P004") < DEFAULT_RATING);
+
+    // Ranks agree with the ratings, and getRange lists the same order
+    vector<RatingKey> range = engine.getRange(1, 4);
+    CHECK_EQUAL(range.size(), 4u);
+    for (size_t i = 0; i < range.size(); i++) {
+        CHECK_EQUAL(engine.getRank(range[i].second), (int)i + 1);
+        CHECK_EQUAL(engine.getRating(range[i].second), range[i].first);
+        if (i > 0) CHECK(range[i - 1].first >= range[i].first);
+    }
+}
@@ -0,0 +1,354 @@
+#include "TestSupport.h"
+#include "core/MatchHistory.h"
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------
+ * ------------------------------------------------ Scheduling Tests ----------------------------------------------
+ * ----------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * Write a player file with every player in one stage, ranked by number, and the three stage courts
+ * @param count the number of players (P001, P002, ...)
+ * @param stageID the stage of every player
+ */
+static void writeTournament(int count, const string& stageID) {
+    ofstream players("Players.txt");
+    for (int i = 1; i <= count; i++) {
+        players << "P" << setw(3) << setfill('0') << i << ",Player " << i << ",MY," << i << "," << (i % 2 ? "M" : "F") << "," << stageID << "\n";
+    }
+    players.close();
+    ofstream("Court.txt") << "C001,Center,1500,2\nC002,Championship,1000,1\nC003,Progression,750,1\n";
+    ofstream("Matches.txt").close();
+}
+
+// Stage of a player as saved in Players.txt, "" if the player is not there
+static string savedStage(const string& playerID) {
+    AsyncFileWriter::instance().flush();
+    ifstream file("Players.txt");
+    string line;
+    while (getline(file, line)) {
+        stringstream ss(line);
+        string field;
+        vector<string> fields;
+        while (getline(ss, field, ',')) fields.push_back(field);
+        if (!fields.empty() && fields[0] == playerID) return fields.back();
+    }
+    return "";
+}
+
+// Group of every player as saved in Groups.txt
+static map<string, string> savedGroups() {
+    map<string, string> groupOf;
+    ifstream file("Groups.txt");
+    string line;
+    while (getline(file, line)) groupOf[line.substr(line.find(',') + 1)] = line.substr(0, line.find(','));
+    return groupOf;
+}
+
+// Indexes of the scheduler's rows of a stage with a status
+static vector<int> rowsWithStatus(const TournamentScheduler& scheduler, const string& stageID, const string& status) {
+    vector<int> rows;
+    for (int i = 0; i < scheduler.getMatchCount(); i++) {
+        if (scheduler.getMatch(i).stageID == stageID && scheduler.getMatch(i).matchStatus == status) rows.push_back(i);
+    }
+    return rows;
+}
+
+TEST_CASE(stageDrawRecordsTheBye) {
+    writeTournament(3, "S001");
+    TournamentScheduler scheduler;
+    CHECK_EQUAL(scheduler.scheduleAllStages(), 1);
+
+    // Seed 1 plays seed 3, and the middle seed holds the bye
+    vector<int> played = rowsWithStatus(scheduler, "S001", "waiting");
+    vector<int> byes = rowsWithStatus(scheduler, "S001", DRAW_BYE_STATUS);
+    CHECK_EQUAL(played.size(), 1u);
+    CHECK_EQUAL(byes.size(), 1u);
+    const Matches& match = scheduler.getMatch(played[0]);
+    CHECK_EQUAL(match.p1ID, string("P001"));
+    CHECK_EQUAL(match.p2ID, string("P003"));
+    const Matches& bye = scheduler.getMatch(byes[0]);
+    CHECK_EQUAL(bye.p1ID, string("P002"));
+    CHECK_EQUAL(bye.p2ID, BRACKET_BYE);
+    CHECK_EQUAL(bye.scheduledTime, TIME_TBD);
+
+    // The bye is saved, so a second run neither draws the holder again nor hands out another bye
+    TournamentScheduler reloaded;
+    CHECK_EQUAL(reloaded.getMatchCount(), 2);
+    CHECK_EQUAL(reloaded.scheduleAllStages(), 0);
+    CHECK_EQUAL(reloaded.getMatchCount(), 2);
+
+    // No result can be recorded for the bye itself
+    MatchHistoryManager history;
+    MatchHistory recorded;
+    CHECK(!history.recordResult(bye.matchID, 2, 0, "01:00", recorded));
+}
+
+TEST_CASE(advanceStageLetsTheByeHolderThrough) {
+    writeTournament(3, "S001");
+    string matchID;
+    {
+        TournamentScheduler scheduler;
+        scheduler.scheduleAllStages();
+        matchID = scheduler.getMatch(rowsWithStatus(scheduler, "S001", "waiting")[0]).matchID;
+    }
+    MatchHistoryManager history;
+    MatchHistory recorded;
+    CHECK(history.recordResult(matchID, 0, 2, "90:00", recorded));
+
+    TournamentScheduler scheduler;
+    CHECK_EQUAL(scheduler.advanceStage("S001"), 2);
+    CHECK_EQUAL(savedStage("P003"), string("S002"));
+    CHECK_EQUAL(savedStage("P002"), string("S002"));
+    CHECK_EQUAL(savedStage("P001"), string("S001"));
+}
+
+// Index of the scheduler's row for a stage and round, -1 if there is none
+static int findRow(const TournamentScheduler& scheduler, const string& stageID, const string& roundID) {
+    for (int i = 0; i < scheduler.getMatchCount(); i++) {
+        if (scheduler.getMatch(i).stageID == stageID && scheduler.getMatch(i).roundID == roundID) return i;
+    }
+    return -1;
+}
+
+TEST_CASE(knockoutMatchAvoidsScheduledCourtTimes) {
+    writeTournament(4, "S003");
+    // The first round at 07:00 and 08:00, the last round robin match at 11:00, and a match
+    // the scheduler placed on the knockout court at 13:00
+    ofstream("Matches.txt") << "M001,S003,R001,P001,P004,28-04-2025 07:00,waiting,C003\n"
+                            << "M002,S003,R001,P002,P003,28-04-2025 08:00,waiting,C003\n"
+                            << "M003,S002,R001,P020,P021,28-04-2025 11:00,waiting,C002\n"
+                            << "M004,S003,R001,P030,P031,28-04-2025 13:00,waiting,C003\n";
+    KnockoutBracket bracket;
+    bracket.build({"P001", "P002", "P003", "P004"});
+    vector<int> ready = bracket.getReadyMatches();
+    CHECK_EQUAL(ready.size(), 2u);
+    bracket.assignMatch(ready[1], "M001", makeMatchTime(28, 4, 2025, 7));
+    bracket.assignMatch(ready[0], "M002", makeMatchTime(28, 4, 2025, 8));
+    CHECK(bracket.reportResult("M001", "P001"));
+    CHECK(bracket.reportResult("M002", "P003"));
+
+    // The final waits for the rest after the round robin (13:00) and skips the taken slot
+    AsyncFileWriter::instance().flush();
+    TournamentScheduler scheduler;
+    int final = findRow(scheduler, "S003", "R002");
+    CHECK(final != -1);
+    CHECK_EQUAL(scheduler.getMatch(final).p1ID, string("P001"));
+    CHECK_EQUAL(scheduler.getMatch(final).p2ID, string("P003"));
+    CHECK_EQUAL(formatMatchTime(scheduler.getMatch(final).scheduledTime), string("28-04-2025 14:00"));
+}
+
+TEST_CASE(historyReloadsAChangedBracket) {
+    writeTournament(4, "S003");
+    // Opened before the draw, so it starts without a bracket
+    MatchHistoryManager history;
+
+    vector<string> firstRound;
+    {
+        TournamentScheduler scheduler;
+        CHECK_EQUAL(scheduler.scheduleAllStages(), 2);
+        for (int i = 0; i < scheduler.getMatchCount(); i++) firstRound.push_back(scheduler.getMatch(i).matchID);
+    }
+    MatchHistory recorded;
+    for (const string& matchID : firstRound) {
+        CHECK(history.recordResult(matchID, 2, 0, "60:00", recorded));
+    }
+
+    // The results reached the new bracket, which scheduled the final
+    AsyncFileWriter::instance().flush();
+    TournamentScheduler scheduler;
+    CHECK(findRow(scheduler, "S003", "R002") != -1);
+}
+
+TEST_CASE(roundRobinPairsEveryGroupOnce) {
+    writeTournament(10, "S002");
+    TournamentScheduler scheduler;
+    // Groups of 4, 3 and 3: 6 + 3 + 3 matches
+    CHECK_EQUAL(scheduler.scheduleAllStages(), 12);
+
+    map<string, string> groupOf = savedGroups();
+    CHECK_EQUAL(groupOf.size(), 10u);
+
+    set<pair<string, string>> pairs;
+    map<string, set<MatchTime>> playerTimes;
+    for (int i = 0; i < scheduler.getMatchCount(); i++) {
+        const Matches& match = scheduler.getMatch(i);
+        CHECK_EQUAL(match.stageID, string("S002"));
+        CHECK_EQUAL(groupOf[match.p1ID], groupOf[match.p2ID]);
+        CHECK(pairs.insert(minmax(match.p1ID, match.p2ID)).second);
+        // Nobody plays twice at the same time
+        CHECK(match.scheduledTime >= 0);
+        CHECK(playerTimes[match.p1ID].insert(match.scheduledTime).second);
+        CHECK(playerTimes[match.p2ID].insert(match.scheduledTime).second);
+    }
+    // Every player meets every other member of their group
+    for (const auto& player : playerTimes) {
+        int groupSize = count_if(groupOf.begin(), groupOf.end(), [&](const pair<const string, string>& member) {
+            return member.second == groupOf[player.first];
+        });
+        CHECK_EQUAL((int)player.second.size(), groupSize - 1);
+    }
+}
+
+TEST_CASE(groupStandingsSkipLevelScores) {
+    GroupStandings standings;
+    standings.setGroups({{"P001", "P002", "P003"}});
+    ofstream("MatchHistory.txt") << "H001,M001,S002,P001,P002,2-1,28-04-2025 09:00,90:00\n"
+                                 << "H002,M002,S002,P002,P003,1-1,28-04-2025 10:00,90:00\n"
+                                 << "H003,M003,S002,P003,P001,0-2,28-04-2025 11:00,90:00\n";
+    standings.refresh();
+
+    vector<GroupStanding> table = standings.getTable("G01");
+    CHECK_EQUAL(table.size(), 3u);
+    CHECK_EQUAL(table[0].playerID, string("P001"));
+    CHECK_EQUAL(table[0].wins, 2);
+    // The level row gives P003 no win over P002
+    CHECK_EQUAL(table[1].playerID, string("P002"));
+    CHECK_EQUAL(table[1].played, 1);
+    CHECK_EQUAL(table[1].losses, 1);
+    CHECK_EQUAL(table[2].playerID, string("P003"));
+    CHECK_EQUAL(table[2].played, 1);
+    CHECK_EQUAL(table[2].wins, 0);
+    CHECK_EQUAL(table[2].losses, 1);
+}
+
+/**
+ * Record a 2-0 win for player 1 of every round-robin match of one group
+ * @param group the group name
+ * @return the number of results recorded
+ */
+static int recordGroupResults(const string& group) {
+    map<string, string> groupOf = savedGroups();
+    TournamentScheduler scheduler;
+    MatchHistoryManager history;
+    MatchHistory recorded;
+    int results = 0;
+    for (int i = 0; i < scheduler.getMatchCount(); i++) {
+        const Matches& match = scheduler.getMatch(i);
+        if (match.stageID != "S002" || groupOf[match.p1ID] != group) continue;
+        CHECK(history.recordResult(match.matchID, 2, 0, "60:00", recorded));
+        results++;
+    }
+    return results;
+}
+
+TEST_CASE(advanceStageWaitsForEveryResult) {
+    writeTournament(4, "S001");
+    vector<string> draw;
+    {
+        // No matches yet: nothing to advance from
+        TournamentScheduler scheduler;
+        CHECK_EQUAL(scheduler.advanceStage("S001"), 0);
+        CHECK_EQUAL(scheduler.scheduleAllStages(), 2);
+        for (int i = 0; i < scheduler.getMatchCount(); i++) draw.push_back(scheduler.getMatch(i).matchID);
+    }
+    MatchHistoryManager history;
+    MatchHistory recorded;
+    CHECK(history.recordResult(draw[0], 2, 0, "60:00", recorded));
+
+    // One of the two matches has a result: nobody advances, and the stage is named
+    stringstream errors;
+    streambuf* previous = cerr.rdbuf(errors.rdbuf());
+    int advanced = TournamentScheduler().advanceStage("S001");
+    cerr.rdbuf(previous);
+    CHECK_EQUAL(advanced, 0);
+    CHECK(errors.str().find("Stage S001 (1)") != string::npos);
+    CHECK_EQUAL(savedStage("P001"), string("S001"));
+
+    // With the second result both winners advance
+    CHECK(history.recordResult(draw[1], 2, 0, "60:00", recorded));
+    CHECK_EQUAL(TournamentScheduler().advanceStage("S001"), 2);
+    CHECK_EQUAL(savedStage("P001"), string("S002"));
+    CHECK_EQUAL(savedStage("P002"), string("S002"));
+    CHECK_EQUAL(savedStage("P003"), string("S001"));
+}
+
+TEST_CASE(advanceStageReportsUnfinishedGroups) {
+    writeTournament(8, "S002");
+    CHECK_EQUAL(TournamentScheduler().scheduleAllStages(), 12);
+    CHECK_EQUAL(recordGroupResults("G01"), 6);
+
+    // Group G02 has no results yet, so G01 does not advance on its own either
+    stringstream errors;
+    streambuf* previous = cerr.rdbuf(errors.rdbuf());
+    int advanced = TournamentScheduler().advanceStage("S002");
+    cerr.rdbuf(previous);
+    CHECK_EQUAL(advanced, 0);
+    CHECK(errors.str().find("Group G02 (6)") != string::npos);
+    CHECK(errors.str().find("G01") == string::npos);
+
+    // Both groups complete: the top two of each advance
+    CHECK_EQUAL(recordGroupResults("G02"), 6);
+    CHECK_EQUAL(TournamentScheduler().advanceStage("S002"), 2 * QUALIFIERS_PER_GROUP);
+}
+
+TEST_CASE(optimizerKeepsTheHardConstraints) {
+    Courts courts[] = {{"C001", "Center", 1500, 2}, {"C002", "Championship", 1000, 1}, {"C003", "Progression", 750, 1}};
+    MatchTime replanFrom = makeMatchTime(28, 4, 2025, 9) + 30;
+    ScheduleOptimizer optimizer(courts, 3, replanFrom);
+
+    // Fixed matches before the re-plan: one blocks P001's rest, one fills C002 and C003 at 10:00
+    struct Row { string p1ID, p2ID; int phase; MatchTime time; int courtIndex; };
+    vector<Row> rows = {{"P001", "P002", 100, makeMatchTime(28, 4, 2025, 9), 0},
+                        {"P020", "P021", 100, makeMatchTime(28, 4, 2025, 10), 1},
+                        {"P022", "P023", 100, makeMatchTime(28, 4, 2025, 10), 2}};
+    for (const Row& row : rows) optimizer.addFixed(row.p1ID, row.p2ID, row.time, row.courtIndex, row.phase);
+    size_t fixedCount = rows.size();
+
+    // Three phases over 12 players, more matches than one day holds
+    mt19937 rng(5);
+    for (int i = 0; i < 60; i++) {
+        string p1 = "P" + to_string(100 + rng() % 12), p2 = "P" + to_string(100 + rng() % 12);
+        if (p1 == p2) continue;
+        int phase = 100 + 10 * (i / 20);
+        optimizer.addMatch(p1, p2, phase);
+        rows.push_back({p1, p2, phase, TIME_TBD, -1});
+    }
+    rows.push_back({"P001", "P003", 100, TIME_TBD, -1});
+    optimizer.addMatch("P001", "P003", 100);
+    CHECK(optimizer.optimize(30) > 0);
+
+    map<pair<MatchTime, int>, int> courtUse;
+    for (size_t i = 0; i < rows.size(); i++) {
+        if (i >= fixedCount) {
+            rows[i].time = optimizer.getTime(i - fixedCount);
+            rows[i].courtIndex = optimizer.getCourtIndex(i - fixedCount);
+            CHECK(rows[i].time >= replanFrom);
+            int hour = (rows[i].time % 1440) / 60;
+            CHECK(rows[i].time % 60 == 0 && hour >= DAY_FIRST_HOUR && hour < DAY_FIRST_HOUR + SLOTS_PER_DAY);
+        }
+        int& used = courtUse[make_pair(rows[i].time, rows[i].courtIndex)];
+        CHECK(++used <= courts[rows[i].courtIndex].maxConcurrentMatches);
+    }
+    for (size_t i = 0; i < rows.size(); i++) {
+        for (size_t j = i + 1; j < rows.size(); j++) {
+            // Rest: a player's two matches of one day are MIN_REST_SLOTS hours apart
+            bool shared = rows[i].p1ID == rows[j].p1ID || rows[i].p1ID == rows[j].p2ID ||
+                          rows[i].p2ID == rows[j].p1ID || rows[i].p2ID == rows[j].p2ID;
+            if (shared && rows[i].time / 1440 == rows[j].time / 1440) {
+                CHECK(abs(rows[i].time - rows[j].time) >= MIN_REST_SLOTS * 60);
+            }
+            // Phases: a placed match starts after every match of an earlier phase
+            if (j >= fixedCount && rows[i].phase < rows[j].phase) CHECK(rows[i].time < rows[j].time);
+            if (i >= fixedCount && rows[j].phase < rows[i].phase) CHECK(rows[j].time < rows[i].time);
+        }
+    }
+}
+
+TEST_CASE(optimizeScheduleMovesOnlyWaitingMatches) {
+    writeTournament(6, "S001");
+    ofstream("Matches.txt") << "M001,S001,R001,P001,P002,28-04-2025 07:00,completed,C003\n"
+                            << "M002,S001,R001,P003,P004,28-04-2025 12:00,waiting,C003\n"
+                            << "M003,S001,R001,P005,-,TBD,bye,C003\n"
+                            << "M004,S001,R001,P001,P006,TBD,waiting,C003\n";
+    TournamentScheduler scheduler;
+    CHECK_EQUAL(scheduler.optimizeSchedule(20, tournamentStart()), 2);
+
+    CHECK_EQUAL(formatMatchTime(scheduler.getMatch(0).scheduledTime), string("28-04-2025 07:00"));
+    CHECK_EQUAL(scheduler.getMatch(2).scheduledTime, TIME_TBD);
+    CHECK_EQUAL(scheduler.getMatch(2).matchStatus, DRAW_BYE_STATUS);
+    // The waiting matches are placed, P001 after the rest from its completed match
+    CHECK(scheduler.getMatch(1).scheduledTime >= 0);
+    CHECK(scheduler.getMatch(3).scheduledTime >= makeMatchTime(28, 4, 2025, 7) + MIN_REST_SLOTS * 60);
+}
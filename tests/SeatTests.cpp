@@ -0,0 +1,184 @@
+#include "TestSupport.h"
+#include "core/Ticketing.h"
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------
+ * ------------------------------------------ Seat Map and Seat Hold Tests ----------------------------------------
+ * ----------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * Mark seat blocks in a reference grid, failing on a seat that is outside its row or already taken
+ * @param taken the reference grid, one row per seat map row
+ * @param blocks the blocks to mark
+ * @param isTaken True: take the seats, False: free them
+ * @return the number of seats marked
+ */
+static int markBlocks(vector<vector<bool>>& taken, const vector<SeatBlock>& blocks, bool isTaken) {
+    int seats = 0;
+    for (const SeatBlock& block : blocks) {
+        CHECK(block.row >= 0 && block.row < (int)taken.size());
+        CHECK(block.count > 0 && block.firstSeat >= 0 && block.firstSeat + block.count <= (int)taken[block.row].size());
+        for (int seat = block.firstSeat; seat < block.firstSeat + block.count; seat++) {
+            CHECK(taken[block.row][seat] != isTaken);
+            taken[block.row][seat] = isTaken;
+        }
+        seats += block.count;
+    }
+    return seats;
+}
+
+TEST_CASE(seatMapKeepsPartiesTogether) {
+    // 70 seats per row: every row spans two bitmap words
+    CourtSeatMap seatMap("C001");
+    seatMap.addSection("A", 2, 70);
+    seatMap.addSection("B", 1, 10);
+    CHECK_EQUAL(seatMap.getTotalSeats(), 150);
+
+    vector<SeatBlock> first = seatMap.allocate(5);
+    CHECK_EQUAL(first.size(), 1u);
+    CHECK_EQUAL(seatMap.describe(first), string("A-R01-S01..S05"));
+
+    // A run across the word boundary of the row
+    vector<SeatBlock> second = seatMap.allocate(62);
+    CHECK_EQUAL(second.size(), 1u);
+    CHECK_EQUAL(second[0].row, 0);
+    CHECK_EQUAL(second[0].firstSeat, 5);
+
+    // Three seats are left in row 1, so a party of four moves to row 2
+    vector<SeatBlock> third = seatMap.allocate(4);
+    CHECK_EQUAL(seatMap.describe(third), string("A-R02-S01..S04"));
+
+    // The last section is labelled from its own first row
+    seatMap.allocate(66);
+    vector<SeatBlock> fourth = seatMap.allocate(9);
+    CHECK_EQUAL(seatMap.describe(fourth), string("B-R01-S01..S09"));
+    CHECK_EQUAL(seatMap.getFreeSeats(), 150 - 5 - 62 - 4 - 66 - 9);
+
+    // More seats than are free: nothing is taken
+    CHECK(seatMap.allocate(10).empty());
+    CHECK_EQUAL(seatMap.getFreeSeats(), 4);
+
+    // A party larger than any run is split over the free seats
+    vector<SeatBlock> split = seatMap.allocate(4);
+    int seats = 0;
+    for (const SeatBlock& block : split) seats += block.count;
+    CHECK_EQUAL(seats, 4);
+    CHECK(split.size() > 1);
+    CHECK_EQUAL(seatMap.getFreeSeats(), 0);
+
+    seatMap.release(second);
+    CHECK_EQUAL(seatMap.getFreeSeats(), 62);
+    CHECK_EQUAL(seatMap.describe(seatMap.allocate(62)), string("A-R01-S06..S67"));
+}
+
+TEST_CASE(seatMapMatchesReferenceModel) {
+    const int rows = 12;
+    const int seatsPerRow = 130;
+    CourtSeatMap seatMap("C002");
+    seatMap.addSection("A", rows / 2, seatsPerRow);
+    seatMap.addSection("B", rows / 2, seatsPerRow);
+    vector<vector<bool>> taken(rows, vector<bool>(seatsPerRow, false));
+    vector<vector<SeatBlock>> parties;
+    int freeSeats = rows * seatsPerRow;
+
+    mt19937 rng(11);
+    for (int step = 0; step < 4000; step++) {
+        if (!parties.empty() && rng() % 3 == 0) {
+            size_t index = rng() % parties.size();
+            freeSeats += markBlocks(taken, parties[index], false);
+            seatMap.release(parties[index]);
+            parties.erase(parties.begin() + index);
+        } else {
+            int count = rng() % 12 + 1;
+            vector<SeatBlock> blocks = seatMap.allocate(count);
+            if (count > freeSeats) {
+                CHECK(blocks.empty());
+            } else {
+                CHECK_EQUAL(markBlocks(taken, blocks, true), count);
+                freeSeats -= count;
+                parties.push_back(blocks);
+            }
+        }
+        CHECK_EQUAL(seatMap.getFreeSeats(), freeSeats);
+    }
+}
+
+/**
+ * A seat hold manager over one court of 40 seats
+ */
+struct HoldFixture {
+    map<string, CourtSeatMap> seatMaps;
+    SeatHoldManager holds;
+
+    HoldFixture() : holds(seatMaps) {
+        seatMaps["C003"] = CourtSeatMap("C003");
+        seatMaps["C003"].addSection("A", 4, 10);
+    }
+
+    int freeSeats() { return seatMaps["C003"].getFreeSeats(); }
+};
+
+TEST_CASE(seatHoldExpiresOnTime) {
+    HoldFixture fixture;
+    long long placedAt = time(0);
+    uint64_t hold = fixture.holds.place("C003", 4, 30);
+    CHECK(hold != NO_HOLD);
+    CHECK_EQUAL(fixture.freeSeats(), 36);
+
+    // The hold expires 30 seconds after it was placed (the clock may tick once while placing)
+    CHECK_EQUAL(fixture.holds.advance(placedAt + 29), 0);
+    CHECK_EQUAL(fixture.holds.getActiveHolds(), 1);
+    CHECK_EQUAL(fixture.holds.advance(placedAt + 31), 1);
+    CHECK_EQUAL(fixture.holds.getActiveHolds(), 0);
+    CHECK_EQUAL(fixture.freeSeats(), 40);
+
+    vector<SeatBlock> seats;
+    CHECK(!fixture.holds.confirm(hold, seats));
+}
+
+TEST_CASE(seatHoldCascadesFromUpperLevels) {
+    // 100 seconds sits on level 1 and 5000 seconds on level 2 of the wheel
+    HoldFixture fixture;
+    long long placedAt = time(0);
+    uint64_t shortHold = fixture.holds.place("C003", 2, 100);
+    uint64_t longHold = fixture.holds.place("C003", 3, 5000);
+    CHECK(shortHold != NO_HOLD && longHold != NO_HOLD);
+    CHECK_EQUAL(fixture.freeSeats(), 35);
+
+    CHECK_EQUAL(fixture.holds.advance(placedAt + 98), 0);
+    CHECK_EQUAL(fixture.holds.advance(placedAt + 102), 1);
+    CHECK_EQUAL(fixture.freeSeats(), 37);
+    CHECK_EQUAL(fixture.holds.advance(placedAt + 4998), 0);
+    CHECK_EQUAL(fixture.holds.advance(placedAt + 5002), 1);
+    CHECK_EQUAL(fixture.freeSeats(), 40);
+}
+
+TEST_CASE(seatHoldConfirmAndRelease) {
+    HoldFixture fixture;
+    uint64_t sold = fixture.holds.place("C003", 6, HOLD_TTL_SECONDS);
+    uint64_t cancelled = fixture.holds.place("C003", 5, HOLD_TTL_SECONDS);
+    CHECK_EQUAL(fixture.freeSeats(), 29);
+
+    // A confirmed hold hands over its seats, which stay taken
+    vector<SeatBlock> seats;
+    CHECK(fixture.holds.confirm(sold, seats));
+    CHECK_EQUAL(fixture.seatMaps["C003"].describe(seats), string("A-R01-S01..S06"));
+    CHECK_EQUAL(fixture.freeSeats(), 29);
+    CHECK(!fixture.holds.confirm(sold, seats));
+
+    // A released hold gives its seats back
+    fixture.holds.release(cancelled);
+    CHECK_EQUAL(fixture.freeSeats(), 34);
+    CHECK_EQUAL(fixture.holds.getActiveHolds(), 0);
+
+    // The freed slab entry is reused, and the old handle does not reach the new hold
+    uint64_t reused = fixture.holds.place("C003", 2, HOLD_TTL_SECONDS);
+    CHECK(reused != cancelled);
+    CHECK(!fixture.holds.confirm(cancelled, seats));
+    CHECK_EQUAL(fixture.holds.getActiveHolds(), 1);
+
+    // A party that does not fit gets no hold
+    CHECK_EQUAL(fixture.holds.place("C003", 40, HOLD_TTL_SECONDS), NO_HOLD);
+    CHECK_EQUAL(fixture.holds.place("C009", 1, HOLD_TTL_SECONDS), NO_HOLD);
+}
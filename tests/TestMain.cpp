@@ -0,0 +1,56 @@
+#include "TestSupport.h"
+#include "core/AsyncWriter.h"
+
+#include <filesystem>
+#include <unistd.h>
+
+vector<TestCase>& testCases() {
+    static vector<TestCase> cases;
+    return cases;
+}
+
+/**
+ * Run one case in a fresh scratch directory, which is removed afterwards
+ * @param test the case
+ * @return True if the case passed, else False
+ */
+static bool runCase(const TestCase& test) {
+    namespace fs = std::filesystem;
+    string scratchTemplate = (fs::temp_directory_path() / "tournament_test_XXXXXX").string();
+    if (mkdtemp(&scratchTemplate[0]) == nullptr || chdir(scratchTemplate.c_str()) != 0) {
+        cerr << "[ FAIL ] " << test.name << ": could not create a scratch directory" << endl;
+        return false;
+    }
+
+    bool passed = true;
+    try {
+        test.body();
+    } catch (const exception& error) {
+        cerr << "[ FAIL ] " << test.name << ": " << error.what() << endl;
+        passed = false;
+    }
+    // Writes still queued must not land in the next case's directory
+    AsyncFileWriter::instance().flush();
+    if (chdir(fs::temp_directory_path().c_str()) == 0) {
+        error_code ignored;
+        fs::remove_all(scratchTemplate, ignored);
+    }
+    if (passed) cout << "[  OK  ] " << test.name << endl;
+    return passed;
+}
+
+int main(int argc, char* argv[]) {
+    int failed = 0;
+    int ran = 0;
+    for (const TestCase& test : testCases()) {
+        if (argc > 1 && test.name != argv[1]) continue;
+        ran++;
+        if (!runCase(test)) failed++;
+    }
+    if (ran == 0) {
+        cerr << "No test case named " << (argc > 1 ? argv[1] : "") << endl;
+        return 1;
+    }
+    cout << (ran - failed) << " of " << ran << " test cases passed" << endl;
+    return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,57 @@
+#ifndef TESTS_TESTSUPPORT_H
+#define TESTS_TESTSUPPORT_H
+
+#include "core/Common.h"
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------
+ * ------------------------------------------------- Test Support -------------------------------------------------
+ * ----------------------------------------------------------------------------------------------------------------
+ * Usage: tournament_tests [case name]
+ * Every case runs in a fresh scratch directory, because the core reads and writes its files in the current
+ * directory. ctest runs each case as its own process, so the singletons (event log, file writer) start clean.
+ */
+
+// A failed check, thrown so the rest of the case is skipped
+class TestFailure : public runtime_error {
+    public:
+        TestFailure(const string& message) : runtime_error(message) {}
+};
+
+// One registered test case
+struct TestCase {
+    string name;
+    void (*body)();
+};
+
+// The registered test cases, in registration order
+vector<TestCase>& testCases();
+
+// Registers a test case from a static initialiser
+struct TestRegistrar {
+    TestRegistrar(const string& name, void (*body)()) { testCases().push_back({name, body}); }
+};
+
+#define TEST_CASE(name) \
+    static void name(); \
+    static TestRegistrar name##Registrar(#name, name); \
+    static void name()
+
+#define CHECK(condition) \
+    do { \
+        if (!(condition)) throw TestFailure(string(__FILE__) + ":" + to_string(__LINE__) + ": CHECK(" #condition ") failed"); \
+    } while (false)
+
+#define CHECK_EQUAL(actual, expected) \
+    do { \
+        auto actualValue = (actual); \
+        auto expectedValue = (expected); \
+        if (!(actualValue == expectedValue)) { \
+            stringstream message; \
+            message << __FILE__ << ":" << __LINE__ << ": CHECK_EQUAL(" #actual ", " #expected ") failed: " \
+                    << actualValue << " != " << expectedValue; \
+            throw TestFailure(message.str()); \
+        } \
+    } while (false)
+
+#endif
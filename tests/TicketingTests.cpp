@@ -0,0 +1,42 @@
+#include "TestSupport.h"
+#include "core/Ticketing.h"
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------
+ * ------------------------------------------------- Ticketing Tests ----------------------------------------------
+ * ----------------------------------------------------------------------------------------------------------------
+ */
+
+TEST_CASE(salesRecordsStayInSaleOrder) {
+    // Left by an earlier session: the first sale of this one replaces it
+    ofstream("Sales.txt") << "TKS001,Old,1,General,TKT001,01-01-2025 10:00:00,Purchased\n";
+
+    TicketingContext context;
+    context.salesCounter = 998;
+    Spectator spectator{"Ann", "VIP", 1, "TKT010", "C001", 2, "M001", "", nullptr, {}, {}, "", 0};
+    for (int sale = 0; sale < 4; sale++) {
+        addToSalesRecord(context, &spectator, sale == 2 ? "Rejected" : "Purchased");
+    }
+
+    // Past TKS999 the IDs gain a digit; the list and the file keep the order of the sales
+    const char* expected[] = {"TKS998", "TKS999", "TKS1000", "TKS1001"};
+    SalesRecord* record = context.salesRecordList;
+    for (const char* salesID : expected) {
+        CHECK(record != nullptr);
+        CHECK_EQUAL(record -> salesID, string(salesID));
+        record = record -> next;
+    }
+    CHECK(record == nullptr);
+    CHECK(context.salesRecordTail -> salesID == "TKS1001");
+
+    AsyncFileWriter::instance().flush();
+    ifstream file("Sales.txt");
+    string line;
+    vector<string> lines;
+    while (getline(file, line)) lines.push_back(line);
+    CHECK_EQUAL(lines.size(), 4u);
+    for (size_t i = 0; i < lines.size(); i++) {
+        CHECK_EQUAL(lines[i].substr(0, lines[i].find(',')), string(expected[i]));
+    }
+    CHECK(lines[2].find(",Rejected") != string::npos);
+}
@@ -0,0 +1,167 @@
+#include "TestSupport.h"
+#include "core/Withdrawals.h"
+
+/**
+ * ----------------------------------------------------------------------------------------------------------------
+ * ------------------------------------------------ Withdrawal Tests ----------------------------------------------
+ * ----------------------------------------------------------------------------------------------------------------
+ */
+
+// Lines of a file, after the queued writes to it have landed
+static vector<string> fileLines(const string& filename) {
+    syncFile(filename);
+    ifstream file(filename);
+    vector<string> lines;
+    string line;
+    while (getline(file, line)) lines.push_back(line);
+    return lines;
+}
+
+TEST_CASE(substituteTakesTheClosestRankedFreePlayer) {
+    // Free in S001: P005 (5), P009 (9), P010 (10) and the earlier withdrawn P012 (12); P020 is in another stage
+    ofstream("Players.txt") << "P001,Player 1,MY,1,M,S001\nP002,Player 2,MY,2,F,S001\n"
+                            << "P003,Player 3,MY,3,M,S001\nP007,Player 7,MY,7,M,S001\n"
+                            << "P005,Player 5,MY,5,F,S001\nP009,Player 9,MY,9,M,S001\n"
+                            << "P010,Player 10,MY,10,F,S001\nP012,Player 12,MY,12,M,S001\n"
+                            << "P020,Player 20,MY,7,F,S002\n";
+    ofstream("Matches.txt") << "M001,S001,R001,P001,P007,28-04-2025 07:00,waiting,C003\n"
+                            << "M002,S001,R001,P002,P007,28-04-2025 09:00,completed,C003\n"
+                            << "M003,S001,R001,P003,P007,28-04-2025 11:00,waiting,C003\n"
+                            << "M004,S001,R001,P002,P001,28-04-2025 13:00,waiting,C003\n";
+    ofstream("Withdrawals.txt") << "W001,P012,Player 12,Injury,2025-04-20 10:00:00\n";
+
+    SubstitutionEngine engine;
+    CHECK(engine.load("Players.txt", "Matches.txt", "Withdrawals.txt"));
+    vector<Substitution> substitutions = engine.substitute({"P007", "P002"});
+
+    // P007 (7) is as close to 5 as to 9: the better ranked P005 goes first, then P009.
+    // The completed match keeps P007, and P002 (2) gets the last free player, P010.
+    CHECK_EQUAL(substitutions.size(), 3u);
+    CHECK_EQUAL(substitutions[0].matchId, string("M001"));
+    CHECK_EQUAL(substitutions[0].substituteId, string("P005"));
+    CHECK_EQUAL(substitutions[1].matchId, string("M003"));
+    CHECK_EQUAL(substitutions[1].substituteId, string("P009"));
+    CHECK_EQUAL(substitutions[2].matchId, string("M004"));
+    CHECK_EQUAL(substitutions[2].withdrawnId, string("P002"));
+    CHECK_EQUAL(substitutions[2].substituteId, string("P010"));
+
+    // The pool is empty now, so a further withdrawal finds no substitute
+    vector<Substitution> none = engine.substitute({"P001"});
+    CHECK_EQUAL(none.size(), 2u);
+    CHECK(none[0].substituteId.empty() && none[1].substituteId.empty());
+}
+
+TEST_CASE(substitutionSaveIsOrderedWithQueuedWrites) {
+    ofstream("Players.txt") << "P001,Player 1,MY,1,M,S001\nP002,Player 2,MY,2,F,S001\nP003,Player 3,MY,3,M,S001\n";
+    // A rewrite still queued in the background writer when the substitution runs
+    AsyncFileWriter::instance().rewrite("Matches.txt", "M001,S001,R001,P001,P002,28-04-2025 07:00,waiting,C003\n"
+                                                       "M002,S001,R001,P002,P001,28-04-2025 09:00,completed,C003\n");
+
+    vector<Substitution> substitutions = substitutePlayers({"P002"}, "Matches.txt", "Players.txt");
+    CHECK_EQUAL(substitutions.size(), 1u);
+    CHECK_EQUAL(substitutions[0].substituteId, string("P003"));
+
+    AsyncFileWriter::instance().flush();
+    vector<string> lines = fileLines("Matches.txt");
+    CHECK_EQUAL(lines.size(), 2u);
+    CHECK_EQUAL(lines[0], string("M001,S001,R001,P001,P003,28-04-2025 07:00,waiting,C003"));
+    CHECK_EQUAL(lines[1], string("M002,S001,R001,P002,P001,28-04-2025 09:00,completed,C003"));
+    CHECK(!ifstream("Matches.txt.tmp"));
+}
+
+TEST_CASE(withdrawBatchContinuesTheHistory) {
+    ofstream("Withdrawals.txt") << "W001,P001,Player 1,Injury,2025-04-20 10:00:00\n"
+                                << "W007,P004,Player 4,Travel, visa delayed,2025-04-21 09:30:00\n";
+    PlayerWithdrawals withdrawals;
+    CHECK_EQUAL(withdrawals.size(), 2);
+    CHECK(withdrawals.withdrawBatch({}).empty());
+
+    vector<Player> recorded = withdrawals.withdrawBatch({{"P010", "Player 10", "Illness"},
+                                                         {"P011", "Player 11", "Family, emergency"},
+                                                         {"P012", "Player 12", "Injury"}});
+    // IDs go on from the highest loaded ID, and every record shares the batch time
+    CHECK_EQUAL(recorded.size(), 3u);
+    CHECK_EQUAL(recorded[0].withdrawalId, string("W008"));
+    CHECK_EQUAL(recorded[2].withdrawalId, string("W010"));
+    CHECK_EQUAL(recorded[0].time, recorded[2].time);
+    CHECK_EQUAL(withdrawals.size(), 5);
+
+    // One append after the loaded lines; a reload reads the reasons with commas back whole
+    vector<string> lines = fileLines("Withdrawals.txt");
+    CHECK_EQUAL(lines.size(), 5u);
+    CHECK_EQUAL(lines[3], "W009,P011,Player 11,Family, emergency," + recorded[1].time);
+    PlayerWithdrawals reloaded;
+    CHECK_EQUAL(reloaded.size(), 5);
+    WithdrawalPage newest = reloaded.recent(1, 2);
+    CHECK_EQUAL(newest.entries[0] -> withdrawalId, string("W010"));
+    CHECK_EQUAL(newest.entries[1] -> reason, string("Family, emergency"));
+    CHECK_EQUAL(reloaded.withdrawBatch({{"P013", "Player 13", "Illness"}})[0].withdrawalId, string("W011"));
+
+    // The batch is logged as one withdrawal event per player
+    const vector<WithdrawalEntry>& logged = EventLog::instance().state().withdrawals;
+    CHECK_EQUAL(logged.size(), 4u);
+    CHECK_EQUAL(logged[1].withdrawal.playerID, string("P011"));
+    CHECK_EQUAL(logged[1].withdrawal.reason, string("Family, emergency"));
+}
+
+TEST_CASE(withdrawPlayersNeverSubstitutesAnotherWithdrawnPlayer) {
+    // P003 is free and ranked closest to P002, but withdraws in the same batch
+    ofstream("Players.txt") << "P001,Player 1,MY,1,M,S001\nP002,Player 2,MY,2,F,S001\n"
+                            << "P003,Player 3,MY,3,M,S001\nP006,Player 6,MY,6,F,S001\n";
+    ofstream("Matches.txt") << "M001,S001,R001,P001,P002,28-04-2025 07:00,waiting,C003\n";
+    PlayerWithdrawals withdrawals;
+    withdrawPlayers(withdrawals, {{"P002", "Player 2", "Injury"}, {"P003", "Player 3", "Injury"}});
+
+    AsyncFileWriter::instance().flush();
+    vector<string> lines = fileLines("Matches.txt");
+    CHECK_EQUAL(lines.size(), 1u);
+    CHECK_EQUAL(lines[0], string("M001,S001,R001,P001,P006,28-04-2025 07:00,waiting,C003"));
+    CHECK_EQUAL(fileLines("Withdrawals.txt").size(), 2u);
+}
+
+TEST_CASE(withdrawalIndexesPageNewestFirst) {
+    ofstream("Withdrawals.txt") << "W001,P001,Player 1,Knee injury,2025-04-20 10:00:00\n"
+                                << "W002,P002,Player 2,Travel delay,2025-04-21 09:00:00\n"
+                                << "W003,P001,Player 1,Shoulder injury, travel ban,2025-04-22 08:00:00\n"
+                                << "W004,P003,Player 3,INJURY (knee),2025-04-23 18:45:00\n"
+                                << "W005,P004,Player 4,Family emergency,2025-04-24 07:15:00\n";
+    PlayerWithdrawals withdrawals;
+
+    // Every record, newest first, over pages of two
+    WithdrawalPage second = withdrawals.recent(2, 2);
+    CHECK_EQUAL(second.total, 5);
+    CHECK_EQUAL(second.entries.size(), 2u);
+    CHECK_EQUAL(second.entries[0] -> withdrawalId, string("W003"));
+    CHECK_EQUAL(second.entries[1] -> withdrawalId, string("W002"));
+    CHECK_EQUAL(withdrawals.recent(3, 2).entries[0] -> withdrawalId, string("W001"));
+    CHECK(withdrawals.recent(4, 2).entries.empty());
+
+    WithdrawalPage player = withdrawals.findByPlayer("P001", 1, 10);
+    CHECK_EQUAL(player.total, 2);
+    CHECK_EQUAL(player.entries[0] -> withdrawalId, string("W003"));
+    CHECK_EQUAL(withdrawals.findByPlayer("P404", 1, 10).total, 0);
+
+    // Keywords are whole words in any case; a query of several words needs all of them
+    CHECK_EQUAL(withdrawals.findByReason("Injury", 1, 10).total, 3);
+    WithdrawalPage knee = withdrawals.findByReason("knee INJURY", 1, 10);
+    CHECK_EQUAL(knee.total, 2);
+    CHECK_EQUAL(knee.entries[0] -> withdrawalId, string("W004"));
+    CHECK_EQUAL(knee.entries[1] -> withdrawalId, string("W001"));
+    WithdrawalPage travel = withdrawals.findByReason("travel, injury", 1, 10);
+    CHECK_EQUAL(travel.total, 1);
+    CHECK_EQUAL(travel.entries[0] -> withdrawalId, string("W003"));
+    CHECK_EQUAL(withdrawals.findByReason("knee family", 1, 10).total, 0);
+    CHECK_EQUAL(withdrawals.findByReason("injur", 1, 10).total, 0);
+
+    // The time window is oldest first, and a date alone covers its whole day
+    WithdrawalPage window = withdrawals.findByTimeWindow("2025-04-21", "2025-04-23", 1, 10);
+    CHECK_EQUAL(window.total, 3);
+    CHECK_EQUAL(window.entries[0] -> withdrawalId, string("W002"));
+    CHECK_EQUAL(window.entries[2] -> withdrawalId, string("W004"));
+
+    // New withdrawals join every index
+    withdrawals.withdrawBatch({{"P005", "Player 5", "Knee injury"}});
+    CHECK_EQUAL(withdrawals.recent(1, 1).entries[0] -> playerId, string("P005"));
+    CHECK_EQUAL(withdrawals.findByReason("injury knee", 1, 10).total, 3);
+    CHECK_EQUAL(withdrawals.findByPlayer("P005", 1, 10).total, 1);
+}